@@ -17,7 +17,7 @@ limitations under the License.
 #ifndef HARNESS_H
 #define HARNESS_H
 
-#include <mach/mach.h>
+#include "mach_compat.h"
 #include <fuzzer/FuzzedDataProvider.h>
 
 typedef struct {
@@ -32,8 +32,10 @@ typedef struct {
 } descriptor_mach_message;
 
 #include "debug.h"
+#ifdef __APPLE__
 #include "initialization.h"
 #include "audit_token.h"
+#endif
 #include "message.h"
 
 #include <stdio.h>
@@ -65,7 +67,18 @@ extern t_AudioHardwareStartServer AudioHardwareStartServer;
 
 extern uint64_t *NextObjectID;
 
-void generate_message(uint32_t msg_id, FuzzedDataProvider& fuzz_data, std::vector<uint8_t>& mach_msg, std::vector<std::pair<void*, uint32_t>>& ool_buffers, bool is_ool_message);
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size);
+
+// Run one sample from shared memory (see setup_shmem) or from a file
+extern "C" int fuzz_shmem();
+extern "C" int fuzz(const char *file_path);
+int setup_shmem(char *name);
+
+// Called between persistent mode inputs, see fuzz_loop.cc for what carries over
+void reset_harness_state(void);
+
+// Command line handling shared by the harness and its Linux stand-in
+int harness_main(int argc, char *argv[]);
 
 // Audit token for Safari
 extern audit_token_t safari_audit_token;
@@ -53,7 +53,7 @@ void print_mach_msg(mach_message *msg, size_t total_size, bool is_ool_message) {
         uint32_t trailer_body_size = *(uint32_t *)(trailer + 4);
         printf("msg_trailer_size: %u\n", trailer_body_size);
         printf("msg_seqno: %u\n", *(uint32_t *)(trailer + 8));
-        printf("msg_sender: %llu\n", *(uint64_t *)(trailer + 12));
+        printf("msg_sender: %llu\n", (unsigned long long)*(uint64_t *)(trailer + 12));
 
         printf("------ MACH MSG TRAILER BODY (%u bytes) ------\n", trailer_body_size);
         for (size_t i = 0; i < trailer_body_size; i++) {
@@ -0,0 +1,224 @@
+/* 
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+// The platform independent part of the harness: getting samples from a file
+// or shared memory, turning each into a sequence of Mach messages and handing
+// them to Mach_Processing_Function. On macOS that is _HALB_MIGServer_server
+// (see the constructor in harness.mm), on Linux it is the mock in
+// tools/mock_processing.cc.
+
+#include "harness.h"
+#include "message_generator.h"
+#include "message_stats.h"
+#include "object_tracker.h"
+#include "persistent.h"
+
+#include <fcntl.h>
+#include <getopt.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+unsigned char *shm_data = NULL;
+t_Mach_Processing_Function Mach_Processing_Function = NULL;
+uint64_t *NextObjectID = NULL;
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    FuzzedDataProvider fuzz_data(data, size);
+
+    // Reused across messages and inputs, the loop below does not allocate
+    message_buffer_t& mach_msg = thread_message_buffer();
+    mach_msg_header_t *return_buffer = thread_return_buffer();
+    static thread_local message_resources_t resources;
+
+    bool first = true;
+    message_stats_input();
+
+    while (fuzz_data.remaining_bytes() >= MACH_MSG_HEADER_SIZE) {
+        verbose_print("\n*******NEW MESSAGE*******\n");
+
+        uint32_t msg_id = consume_message_id(fuzz_data, first);
+        first = false;
+
+        verbose_print("Message ID: %d (%s)\n", msg_id, message_id_to_string(static_cast<message_id_enum>(msg_id)));
+
+        // GENERATE MESSAGE
+        generate_message(msg_id, fuzz_data, mach_msg, resources);
+
+        // Point the message at an object the server has, most of the time
+        object_tracker_apply(msg_id, mach_msg);
+
+        // Cast the buffer to mach_msg_header_t* for the function call
+        mach_msg_header_t *fuzz_mach_msg = (mach_msg_header_t *)mach_msg.data;
+
+        if (verbose) {
+            printf("Sending the following mach msg:\n");
+            print_mach_msg((mach_message *)fuzz_mach_msg, mach_msg.size, true);
+        }
+
+        // Call the processing function
+        uint64_t start = stats_clock();
+        uint64_t result = Mach_Processing_Function(fuzz_mach_msg, return_buffer);
+        uint64_t ticks = stats_clock() - start;
+
+        verbose_print("Processing function result: %llu\n", (unsigned long long)result);
+        if (verbose) {
+            // Print return message
+            verbose_print("Return message:\n");
+            print_mach_msg_no_trailer((mach_message*)return_buffer);
+        }
+
+        message_stats_record(msg_id, result, return_buffer, ticks);
+        object_tracker_observe(msg_id, fuzz_mach_msg, return_buffer);
+
+        // Recycle OOL buffers and ports, replacing whatever the target consumed
+        pool_release(resources);
+    }
+
+    return 0; // Non-crashing inputs should return 0
+}
+
+void reset_harness_state(void) {
+    // The pooled buffers and ports are recycled into the next input, which is
+    // what the pool is for; only the ones the target freed, or left with
+    // missing rights or queued messages, are replaced. A restart starts from an
+    // empty pool anyway. The object tracker stays: the server's objects outlive
+    // the input. So do the message stats, they are about the whole run.
+    pool_check();
+}
+
+extern "C" int fuzz_shmem() {
+    if (shm_data == NULL) {
+        verbose_print("Error: Shared memory data pointer is NULL\n");
+        return 1;
+    }
+
+    // Read the size from shared memory and check for validity
+    size_t size = (size_t)*(uint32_t *)(shm_data);
+    if (size > MAX_SAMPLE_SIZE) {
+        verbose_print("Warning: Size read from shared memory (%zu) exceeds MAX_SAMPLE_SIZE (%d). Truncating to MAX_SAMPLE_SIZE.\n", size, MAX_SAMPLE_SIZE);
+        size = MAX_SAMPLE_SIZE;
+    }
+
+    // Pass the data to the fuzzer straight from shared memory
+    verbose_print("Info: Calling LLVMFuzzerTestOneInput with data size %zu\n", size);
+    LLVMFuzzerTestOneInput((const uint8_t *)shm_data + sizeof(uint32_t), size);
+    return 0;
+}
+
+extern "C" int fuzz(const char *file_path) {
+    FILE *file = fopen(file_path, "rb");
+    if (!file) {
+        perror("Error opening file");
+        printf("Faulty file: %s", file_path);
+        exit(EXIT_FAILURE);
+    }
+
+    fseek(file, 0, SEEK_END);
+    size_t size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    if (size > MAX_SAMPLE_SIZE) size = MAX_SAMPLE_SIZE;
+    uint8_t *data = (uint8_t *)malloc(size);
+    fread(data, 1, size, file);
+    fclose(file);
+
+    LLVMFuzzerTestOneInput(data, size);
+    free(data);
+    return 0;
+}
+
+int setup_shmem(char *name) {
+    int fd;
+
+    // get shared memory file descriptor (NOT a file)
+    fd = shm_open(name, O_RDONLY, S_IRUSR | S_IWUSR);
+    if (fd == -1)
+    {
+        perror("Error in shm_open\n");
+        return 1;
+    }
+
+    // map shared memory to process address space
+    shm_data = (unsigned char *)mmap(NULL, SHM_SIZE, PROT_READ, MAP_SHARED, fd, 0);
+    if (shm_data == MAP_FAILED)
+    {
+        printf("Error in mmap\n");
+        return 1;
+    }
+
+    return 0;
+}
+
+#define HARNESS_USAGE "Usage: %s [-m shmem_name [-p iterations]] [-f file_path] [-s stats_name] [-v] [-b]\n"
+
+int harness_main(int argc, char *argv[]) {
+    char *shmem_name = NULL;
+    char *file_path = NULL;
+    bool persistent = false;
+    persistent_options_t options = {0, reset_harness_state};
+
+    int opt;
+    while ((opt = getopt(argc, argv, "m:f:p:s:vb")) != -1) {
+        switch (opt) {
+            case 'm':
+                shmem_name = optarg;
+                break;
+            case 'f':
+                file_path = optarg;
+                break;
+            case 'p':
+                persistent = true;
+                options.max_iterations = strtoull(optarg, NULL, 0);
+                break;
+            case 's':
+                if (!message_stats_map(optarg)) {
+                    return 1;
+                }
+                break;
+            case 'v':
+                verbose = 1;
+                break;
+            case 'b':
+                print_bytes_only = 1;
+                break;
+            default:
+                fprintf(stderr, HARNESS_USAGE, argv[0]);
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    if (file_path) {
+        fuzz(file_path);
+    } else if (shmem_name && persistent) {
+        shm_data = persistent_map(shmem_name, false);
+        if (shm_data == NULL) {
+            return 1;
+        }
+        persistent_loop(shm_data, options);
+    } else if (shmem_name) {
+        if (setup_shmem(shmem_name) != 0) {
+            perror("Error mapping shared memory\n");
+            return 1;
+        }
+        fuzz_shmem();
+    } else {
+        fprintf(stderr, HARNESS_USAGE, argv[0]);
+        exit(EXIT_FAILURE);
+    }
+
+    return 0;
+}
@@ -0,0 +1,25 @@
+/* 
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+// Globals the message generator shares with the harness. They live apart from
+// fuzz_loop.cc so that the Jackalope mutator can link the generator without
+// the harness loop.
+
+#include "harness.h"
+
+int verbose = 0;
+int print_bytes_only = 0;
+audit_token_t safari_audit_token;
@@ -0,0 +1,114 @@
+/* 
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef MACH_COMPAT_H
+#define MACH_COMPAT_H
+
+#ifdef __APPLE__
+
+#include <mach/mach.h>
+
+#else
+
+// Just enough of <mach/message.h> to build the message generation code on
+// Linux. Layouts match the 64-bit macOS definitions so the bytes we generate
+// (and the offsets the layout table pokes at) are identical on both platforms.
+
+#include <stdint.h>
+
+typedef int kern_return_t;
+typedef int boolean_t;
+typedef unsigned int natural_t;
+typedef natural_t mach_port_t;
+typedef natural_t mach_port_name_t;
+typedef unsigned int mach_msg_bits_t;
+typedef natural_t mach_msg_size_t;
+typedef int mach_msg_id_t;
+typedef unsigned int mach_msg_type_name_t;
+typedef unsigned int mach_msg_copy_options_t;
+typedef unsigned int mach_msg_descriptor_type_t;
+
+#define KERN_SUCCESS 0
+#define MACH_PORT_NULL 0
+#define MACH_MSGH_BITS_COMPLEX 0x80000000U
+
+#define MACH_MSG_TYPE_MOVE_RECEIVE 16
+#define MACH_MSG_TYPE_MAKE_SEND 20
+
+#define MACH_MSG_PORT_DESCRIPTOR 0
+#define MACH_MSG_OOL_DESCRIPTOR 1
+#define MACH_MSG_OOL_PORTS_DESCRIPTOR 2
+#define MACH_MSG_OOL_VOLATILE_DESCRIPTOR 3
+#define MACH_MSG_GUARDED_PORT_DESCRIPTOR 4
+
+#pragma pack(push, 4)
+
+typedef struct {
+    mach_msg_bits_t msgh_bits;
+    mach_msg_size_t msgh_size;
+    mach_port_t msgh_remote_port;
+    mach_port_t msgh_local_port;
+    mach_port_name_t msgh_voucher_port;
+    mach_msg_id_t msgh_id;
+} mach_msg_header_t;
+
+typedef struct {
+    natural_t pad1;
+    mach_msg_size_t pad2;
+    unsigned int pad3 : 24;
+    mach_msg_descriptor_type_t type : 8;
+} mach_msg_type_descriptor_t;
+
+typedef struct {
+    mach_port_t name;
+    mach_msg_size_t pad1;
+    unsigned int pad2 : 16;
+    mach_msg_type_name_t disposition : 8;
+    mach_msg_descriptor_type_t type : 8;
+} mach_msg_port_descriptor_t;
+
+typedef struct {
+    void *address;
+    boolean_t deallocate : 8;
+    mach_msg_copy_options_t copy : 8;
+    unsigned int pad1 : 8;
+    mach_msg_descriptor_type_t type : 8;
+    mach_msg_size_t size;
+} mach_msg_ool_descriptor_t;
+
+typedef struct {
+    void *address;
+    boolean_t deallocate : 8;
+    mach_msg_copy_options_t copy : 8;
+    mach_msg_type_name_t disposition : 8;
+    mach_msg_descriptor_type_t type : 8;
+    mach_msg_size_t count;
+} mach_msg_ool_ports_descriptor_t;
+
+#pragma pack(pop)
+
+typedef struct {
+    unsigned int val[8];
+} audit_token_t;
+
+#endif // __APPLE__
+
+static_assert(sizeof(mach_msg_header_t) == 24, "unexpected mach_msg_header_t layout");
+static_assert(sizeof(mach_msg_port_descriptor_t) == 12, "unexpected port descriptor layout");
+static_assert(sizeof(mach_msg_ool_descriptor_t) == 16, "unexpected OOL descriptor layout");
+static_assert(sizeof(mach_msg_ool_ports_descriptor_t) == 16, "unexpected OOL ports descriptor layout");
+
+#endif // MACH_COMPAT_H
@@ -93,42 +93,3 @@ const char* message_id_to_string(message_id_enum message_id) {
         default: return "Unknown Message ID";
     }
 }
-
-std::set<message_id_enum> ool_descriptor_set = {
-    XObject_SetPropertyData,
-    XIOContext_SetClientControlPort,
-    XIOContext_Start,
-    XIOContext_StartAtTime,
-    XIOContext_Start_With_WorkInterval,
-    XObject_GetPropertyData,
-    XObject_GetPropertyData_DAI32_QAI32,
-    XObject_GetPropertyData_DAI64_QAI64,
-    XObject_GetPropertyData_DCFString_QCFString,
-    XObject_GetPropertyData_DCFString_QPList,
-    XObject_GetPropertyData_DCFString_QRaw,
-    XObject_GetPropertyData_DI32_QCFString,
-    XObject_GetPropertyData_DPList_QCFString,
-    XObject_GetPropertyData_DPList_QPList,
-    XObject_GetPropertyData_DPList_QRaw,
-    XObject_SetPropertyData_DAI32,
-    XObject_SetPropertyData_DAI64,
-    XObject_SetPropertyData_DCFString,
-    XObject_SetPropertyData_DCFString_QCFString,
-    XObject_SetPropertyData_DCFString_QPList,
-    XObject_SetPropertyData_DCFString_QRaw,
-    XObject_SetPropertyData_DPList,
-    XObject_SetPropertyData_DPList_QCFString,
-    XObject_SetPropertyData_DPList_QPList,
-    XObject_SetPropertyData_DPList_QRaw,
-    XSystem_CreateIOContext,
-    XSystem_CreateMetaDevice,
-    XSystem_DeleteSetting,
-    XSystem_Open,
-    XSystem_OpenWithBundleID,
-    XSystem_OpenWithBundleIDAndLinkage,
-    XSystem_OpenWithBundleIDLinkageAndKind,
-    XSystem_OpenWithBundleIDLinkageAndKindAndSynchronousGroupProperties,
-    XSystem_ReadSetting,
-    XSystem_WriteSetting,
-    XTransportManager_CreateDevice
-};
\ No newline at end of file
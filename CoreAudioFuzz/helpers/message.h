@@ -18,7 +18,6 @@ limitations under the License.
 #define MESSAGE_H
 
 #include <iostream>
-#include <set>
 
 typedef enum {
     XSystem_Open = 1010000,
@@ -95,7 +94,6 @@ typedef enum {
     XSystem_OpenWithBundleIDLinkageAndKindAndSynchronousGroupPropertiesAndShmemAndTimeout = 1010071
 } message_id_enum;
 
-extern std::set<message_id_enum> ool_descriptor_set;
 extern const char* message_id_to_string(message_id_enum msg_id);
 
 #endif // MESSAGE_H
\ No newline at end of file
@@ -0,0 +1,126 @@
+/* 
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "message_framing.h"
+
+void frame_sample(const uint8_t *data, size_t size, framed_sample_t& framed) {
+    FuzzedDataProvider fuzz_data(data, size);
+    message_buffer_t& mach_msg = thread_message_buffer();
+    static thread_local message_resources_t resources;
+    size_t front = 0;
+    size_t back = size;
+    bool first = true;
+
+    framed.messages.clear();
+
+    // The same loop as LLVMFuzzerTestOneInput, noting where each message's bytes were
+    while (fuzz_data.remaining_bytes() >= MACH_MSG_HEADER_SIZE) {
+        framed.messages.emplace_back();
+        message_record_t& record = framed.messages.back();
+
+        size_t remaining = fuzz_data.remaining_bytes();
+        record.msg_id = consume_message_id(fuzz_data, first);
+        if (remaining != fuzz_data.remaining_bytes()) {
+            record.id_byte = data[--back];
+        } else {
+            record.id_byte = (uint8_t)(record.msg_id - kFirstMessageId);
+        }
+        first = false;
+
+        generate_message(record.msg_id, fuzz_data, mach_msg, resources, &record.trace);
+        pool_release(resources);
+
+        const message_trace_t& trace = record.trace;
+        record.front.assign(data + front, data + front + trace.front_bytes);
+        record.back.assign(data + back - trace.back_bytes, data + back);
+        front += trace.front_bytes;
+        back -= trace.back_bytes;
+
+        // FuzzedDataProvider only comes up short once nothing is left
+        record.complete = fuzz_data.remaining_bytes() > 0;
+    }
+
+    framed.unused.assign(data + front, data + back);
+}
+
+void unframe_sample(const framed_sample_t& framed, std::vector<uint8_t>& data) {
+    data.clear();
+
+    for (const message_record_t& record : framed.messages) {
+        data.insert(data.end(), record.front.begin(), record.front.end());
+    }
+
+    data.insert(data.end(), framed.unused.begin(), framed.unused.end());
+
+    for (size_t i = framed.messages.size(); i-- > 0;) {
+        const message_record_t& record = framed.messages[i];
+        data.insert(data.end(), record.back.begin(), record.back.end());
+        if (i > 0) {
+            data.push_back(record.id_byte);
+        }
+    }
+}
+
+void set_message_id(message_record_t& record, uint32_t msg_id) {
+    record.msg_id = msg_id;
+    record.id_byte = (uint8_t)(msg_id - kFirstMessageId);
+}
+
+bool set_selector_choice(message_record_t& record, uint32_t selector, uint32_t scope, uint32_t element) {
+    if (record.trace.selector_bytes == 8) {
+        // The coin didn't come up, make room for the choices below it
+        record.back.insert(record.back.begin(), 3, 0);
+        record.trace.selector_bytes = 11;
+    } else if (record.trace.selector_bytes != 11) {
+        return false;
+    }
+
+    // Consumed last first: element, scope, selector, then the coin
+    record.back[0] = (uint8_t)element;
+    record.back[1] = (uint8_t)scope;
+    record.back[2] = (uint8_t)selector;
+    // A probability of 0 is always below 0.95
+    memset(&record.back[3], 0, 8);
+    return true;
+}
+
+bool resize_ool_data(message_record_t& record, uint32_t index, uint32_t size) {
+    if (index >= record.trace.ool_count || size < 1 || size > MAX_OOL_DATA_SIZE) {
+        return false;
+    }
+
+    const auto& ool = record.trace.ool[index];
+    if (ool.size_offset + 2 > record.back.size() || ool.data_offset + ool.data_size > record.front.size()) {
+        return false;
+    }
+
+    // ConsumeIntegralInRange(1, MAX_OOL_DATA_SIZE) reads two bytes, the
+    // higher address first and as the high byte
+    size_t size_index = record.back.size() - ool.size_offset - 2;
+    record.back[size_index] = (uint8_t)((size - 1) & 0xff);
+    record.back[size_index + 1] = (uint8_t)((size - 1) >> 8);
+
+    auto data_begin = record.front.begin() + ool.data_offset;
+    std::vector<uint8_t> data(data_begin, data_begin + ool.data_size);
+    for (uint32_t i = ool.data_size; i < size; i++) {
+        data.push_back(data[i % ool.data_size]);
+    }
+    data.resize(size);
+
+    record.front.erase(data_begin, data_begin + ool.data_size);
+    record.front.insert(record.front.begin() + ool.data_offset, data.begin(), data.end());
+    return true;
+}
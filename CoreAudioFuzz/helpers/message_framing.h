@@ -0,0 +1,68 @@
+/* 
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef MESSAGE_FRAMING_H
+#define MESSAGE_FRAMING_H
+
+#include "message_generator.h"
+
+#include <vector>
+
+// Splits a harness input into the messages LLVMFuzzerTestOneInput would send
+// and puts it back together, so inputs can be edited a message at a time.
+//
+// Each message takes its data from the front of the input and its integers
+// (message ID, sizes, coin flips) from the back, so an input is laid out as
+//
+//   front 0 | front 1 | ... | front n | unused | back n, id n | ... | back 1, id 1 | back 0
+//
+// Messages only read their own bytes. Moving a record elsewhere keeps it
+// decoding the same way, as long as it didn't run out of input. The first
+// message is always XSystem_Open and has no ID byte, so editors leave it in
+// place.
+
+typedef struct {
+    uint32_t msg_id;
+    uint8_t id_byte;                // msg_id is drawn from this, unused for the first message
+    bool complete;                  // false if the input ran out during this message
+    std::vector<uint8_t> front;
+    std::vector<uint8_t> back;      // in input order, without id_byte
+    message_trace_t trace;
+} message_record_t;
+
+typedef struct {
+    std::vector<message_record_t> messages;
+    std::vector<uint8_t> unused;    // left over between the two ends
+} framed_sample_t;
+
+void frame_sample(const uint8_t *data, size_t size, framed_sample_t& framed);
+void unframe_sample(const framed_sample_t& framed, std::vector<uint8_t>& data);
+
+// Edits. The trace is stale afterwards; unframe and frame again to refresh it.
+
+// Send the record as msg_id. The rest of it decodes according to the new layout.
+void set_message_id(message_record_t& record, uint32_t msg_id);
+
+// Make the generator place kValidSelectors[selector], kValidScopes[scope] and
+// kValidElements[element] at the end of the body. False if the record has no
+// selector choice.
+bool set_selector_choice(message_record_t& record, uint32_t selector, uint32_t scope, uint32_t element);
+
+// Resize the data of the record's index'th traced OOL descriptor to size
+// bytes (1 to MAX_OOL_DATA_SIZE), repeating the existing data to grow it
+bool resize_ool_data(message_record_t& record, uint32_t index, uint32_t size);
+
+#endif // MESSAGE_FRAMING_H
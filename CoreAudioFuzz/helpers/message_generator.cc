@@ -0,0 +1,293 @@
+/* 
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "message_generator.h"
+
+#include <cstring>
+
+const std::vector<uint32_t> kValidSelectors = {
+    'grup', 'agrp', 'acom', 'amst', 'apcd', 'tap#', 'atap', '****', 0
+};
+
+const std::vector<uint32_t> kValidScopes = {
+    'glob', 'inpt', 'outp', 'ptru', '****', 0
+};
+
+const std::vector<uint32_t> kValidElements = {
+    0xFFFFFFFF, 0 // Wildcard and Null
+};
+
+static const char kPlistPayload[] = "<?xml version=\"1.0\" encoding=\"UTF-8\"?><!DOCTYPE plist PUBLIC \"-//Apple//DTD PLIST 1.0//EN\" \"http://www.apple.com/DTDs/PropertyList-1.0.dtd\"><plist version=\"1.0\"><dict><key>name</key><string>Aggregate Device</string><key>uid</key><string>DillonFrankeAAAAADillonFrankeAAAAADillonFrankeAAAAAAAAAAAAAAAA21</string></dict></plist>";
+
+uint32_t consume_message_id(FuzzedDataProvider& fuzz_data, bool first) {
+    if (first) {
+        return kFirstMessageId;
+    }
+    // One past the last routine, so unknown IDs get sent too
+    return fuzz_data.ConsumeIntegralInRange<uint32_t>(kFirstMessageId, kLastMessageId + 1);
+}
+
+// Bytes taken from the back of the input since generate_message() started
+static uint32_t back_consumed(const message_trace_t& trace, FuzzedDataProvider& fuzz_data) {
+    return trace.input_size - fuzz_data.remaining_bytes() - trace.front_bytes;
+}
+
+static void generate_header(FuzzedDataProvider& fuzz_data, uint32_t& msg_size, uint32_t msg_id, message_buffer_t& mach_msg, bool is_ool_message, message_trace_t& trace) {
+    // Consume bits for message header
+    uint32_t msg_bits = fuzz_data.ConsumeIntegral<uint32_t>();
+
+    if (is_ool_message) {
+        msg_bits = msg_bits | MACH_MSGH_BITS_COMPLEX;
+    }
+
+    // Check if the message size needs to be generated
+    if (msg_size == 0) {
+        msg_size = fuzz_data.ConsumeIntegralInRange<uint32_t>(MACH_MSG_HEADER_SIZE, 1000);
+    }
+
+    message_put(mach_msg, msg_bits);
+    message_put(mach_msg, msg_size);
+
+    // Consume ports. These may come up short once the input runs out, which
+    // shifts the rest of the message; keep it that way so existing corpora
+    // still decode to the same messages.
+    trace.front_bytes += message_put_input(mach_msg, fuzz_data, 4);  // msgh_remote_port
+    trace.front_bytes += message_put_input(mach_msg, fuzz_data, 4);  // msgh_local_port
+    trace.front_bytes += message_put_input(mach_msg, fuzz_data, 4);  // msgh_voucher_port
+
+    message_put(mach_msg, msg_id);
+}
+
+// Function to flip a weighted coin using FuzzedDataProvider::ConsumeProbability()
+static bool flip_weighted_coin(double probability, FuzzedDataProvider& fuzz_data) {
+    return fuzz_data.ConsumeProbability<double>() < probability;
+}
+
+// Function to choose a random value from a given vector
+static uint32_t choose_one_of(FuzzedDataProvider& fuzz_data, const std::vector<uint32_t>& choices) {
+    return choices[fuzz_data.ConsumeIntegralInRange<size_t>(0, choices.size() - 1)];
+}
+
+// Function to add selector information to the last 16 bytes of the body
+static void add_selector_information(FuzzedDataProvider& fuzz_data, uint8_t *body, size_t body_size, message_trace_t& trace) {
+    if (body_size < 16) {
+        return; // Ensure there's enough space to modify the last 16 bytes
+    }
+
+    size_t remaining = fuzz_data.remaining_bytes();
+
+    if (flip_weighted_coin(0.95, fuzz_data)) {  // 95% probability
+        uint32_t selector = choose_one_of(fuzz_data, kValidSelectors);
+        uint32_t scope = choose_one_of(fuzz_data, kValidScopes);
+        uint32_t element = choose_one_of(fuzz_data, kValidElements);
+        memcpy(body + body_size - 16, &selector, sizeof(uint32_t));
+        memcpy(body + body_size - 12, &scope, sizeof(uint32_t));
+        memcpy(body + body_size - 8, &element, sizeof(uint32_t));
+    }
+
+    trace.selector_bytes = remaining - fuzz_data.remaining_bytes();
+}
+
+static void generate_body(const message_layout_t& layout, FuzzedDataProvider& fuzz_data, message_buffer_t& mach_msg, uint32_t body_size, message_trace_t& trace) {
+    uint32_t body_offset = mach_msg.size;
+
+    trace.front_bytes += message_put_input(mach_msg, fuzz_data, body_size);
+    message_resize(mach_msg, body_offset + body_size);
+
+    if (layout.has_selector) {
+        add_selector_information(fuzz_data, mach_msg.data + body_offset, body_size, trace);
+    }
+}
+
+void print_ool_buffer_contents(void *buffer, size_t size) {
+    uint8_t *byteBuffer = (uint8_t *)buffer;  // Cast the buffer to a byte pointer
+
+    // Print each byte in hexadecimal format
+    printf("OOL Buffer contents (size = %zu bytes):\n", size);
+    for (size_t i = 0; i < size; ++i) {
+        printf("0x%02x ", byteBuffer[i]);
+    }
+    printf("\n");
+}
+
+static void generate_descriptors(const message_layout_t& layout, FuzzedDataProvider& fuzz_data, message_buffer_t& mach_msg, message_resources_t& resources, message_trace_t& trace) {
+    uint32_t descriptor_count = layout.descriptor_count;
+
+    // Consume a descriptor_count if it hasn't been hardcoded for the message
+    if (descriptor_count < 1) {
+        descriptor_count = fuzz_data.ConsumeIntegralInRange<uint32_t>(1, 4);
+    }
+
+    message_put(mach_msg, descriptor_count);
+
+    for (uint32_t i = 0; i < descriptor_count; i++) {
+        mach_msg_descriptor_type_t type;
+        if (i < layout.descriptor_count) {
+            type = layout.descriptor_types[i];
+        } else {
+            // If no descriptor type is given, fuzz one
+            type = fuzz_data.ConsumeIntegralInRange<uint8_t>(0, 2);
+        }
+
+        switch (type) {
+            case MACH_MSG_OOL_DESCRIPTOR: {
+                // Every pooled buffer holds MAX_OOL_DATA_SIZE bytes
+                void* oolBuffer = pool_acquire_ool_buffer(resources);
+                if (oolBuffer == NULL) {
+                    printf("Failed to allocate memory buffer\n");
+                    return;
+                }
+
+                uint32_t size;
+                if (layout.ool_payload != OOL_PAYLOAD_RAW && flip_weighted_coin(0.5, fuzz_data)) {
+                    // Place plist within OOL data
+                    size = sizeof(kPlistPayload);
+                    memcpy(oolBuffer, kPlistPayload, size);
+                } else {
+                    // Generate random data from the fuzz input for the OOL data
+                    uint32_t size_offset = back_consumed(trace, fuzz_data);
+                    uint32_t planned_size = fuzz_data.ConsumeIntegralInRange<uint32_t>(1, MAX_OOL_DATA_SIZE);
+                    uint32_t data_offset = trace.front_bytes;
+                    size = fuzz_data.ConsumeData(oolBuffer, planned_size);
+                    trace.front_bytes += size;
+
+                    // Only complete ones, an editor can't tell how a short one would continue
+                    if (size == planned_size) {
+                        trace.ool[trace.ool_count++] = {size_offset, data_offset, size};
+                    }
+                }
+
+                if (verbose) {
+                    printf("Allocated OOL Buffer contains:\n");
+                    print_ool_buffer_contents(oolBuffer, size);
+                }
+
+                mach_msg_ool_descriptor_t ool_descriptor = {};
+                ool_descriptor.size = size;
+                ool_descriptor.address = oolBuffer;
+                ool_descriptor.deallocate = fuzz_data.ConsumeIntegralInRange<uint8_t>(0, 1);
+                ool_descriptor.copy = fuzz_data.ConsumeIntegralInRange<uint8_t>(0, 4);
+                ool_descriptor.pad1 = fuzz_data.ConsumeIntegral<uint8_t>();
+                ool_descriptor.type = MACH_MSG_OOL_DESCRIPTOR;
+
+                message_put(mach_msg, ool_descriptor);
+
+                break;
+            }
+            case MACH_MSG_PORT_DESCRIPTOR: {
+                mach_msg_port_descriptor_t port_descriptor = {};
+                port_descriptor.name = pool_acquire_port(resources);
+                port_descriptor.pad1 = fuzz_data.ConsumeIntegral<uint32_t>();
+                port_descriptor.pad2 = fuzz_data.ConsumeIntegral<uint16_t>();
+                port_descriptor.disposition = fuzz_data.ConsumeIntegralInRange<uint32_t>(16, 26);
+                port_descriptor.type = MACH_MSG_PORT_DESCRIPTOR;
+
+                message_put(mach_msg, port_descriptor);
+
+                break;
+            }
+            case MACH_MSG_OOL_PORTS_DESCRIPTOR: {
+                mach_msg_ool_ports_descriptor_t ool_ports_descriptor = {};
+
+                uint32_t port_count = fuzz_data.ConsumeIntegralInRange<uint32_t>(0, 4);
+
+                // The array has to outlive this function, the target reads it
+                mach_port_t* port_array = (mach_port_t *)pool_acquire_ool_buffer(resources);
+                if (port_array == NULL) {
+                    printf("Failed to allocate memory buffer\n");
+                    return;
+                }
+
+                for (uint32_t j = 0; j < port_count; j++) {
+                    port_array[j] = pool_acquire_port(resources);  // Create and store port
+                }
+
+                ool_ports_descriptor.address = port_array;
+                ool_ports_descriptor.deallocate = fuzz_data.ConsumeIntegralInRange<uint8_t>(0, 1);
+                ool_ports_descriptor.copy = fuzz_data.ConsumeIntegralInRange<uint8_t>(0, 4);
+                ool_ports_descriptor.disposition = fuzz_data.ConsumeIntegralInRange<uint8_t>(16, 26);
+                ool_ports_descriptor.type = MACH_MSG_OOL_PORTS_DESCRIPTOR;
+                ool_ports_descriptor.count = port_count;
+
+                message_put(mach_msg, ool_ports_descriptor);
+
+                break;
+            }
+            default:
+                break;
+        }
+    }
+}
+
+static void apply_fixups(const message_layout_t& layout, message_buffer_t& mach_msg) {
+    for (const layout_fixup_t& fixup : layout.fixups) {
+        switch (fixup.op) {
+            case FIXUP_SET_U8:
+                mach_msg.data[fixup.offset] = (uint8_t)fixup.value;
+                break;
+            case FIXUP_SET_U16: {
+                uint16_t value = (uint16_t)fixup.value;
+                memcpy(&mach_msg.data[fixup.offset], &value, sizeof(uint16_t));
+                break;
+            }
+            case FIXUP_COPY_U32: {
+                uint32_t value;
+                memcpy(&value, &mach_msg.data[fixup.source], sizeof(uint32_t));
+                value >>= fixup.value;
+                memcpy(&mach_msg.data[fixup.offset], &value, sizeof(uint32_t));
+                break;
+            }
+            case FIXUP_NONE:
+                return;
+        }
+    }
+}
+
+void generate_message(uint32_t msg_id, FuzzedDataProvider& fuzz_data, message_buffer_t& mach_msg, message_resources_t& resources, message_trace_t *trace) {
+    const message_layout_t& layout = message_layout_for(msg_id);
+    uint32_t msg_size = layout.msg_size;
+    message_trace_t local_trace;
+    message_trace_t& t = trace ? *trace : local_trace;
+
+    t = {};
+    t.input_size = fuzz_data.remaining_bytes();
+
+    message_reset(mach_msg);
+
+    // HEADER
+    generate_header(fuzz_data, msg_size, msg_id, mach_msg, layout.is_ool, t);
+
+    // DESCRIPTORS
+    if (layout.is_ool && mach_msg.size < msg_size) {
+        generate_descriptors(layout, fuzz_data, mach_msg, resources, t);
+    }
+
+    // BODY
+    if (mach_msg.size < msg_size) {
+        generate_body(layout, fuzz_data, mach_msg, msg_size - mach_msg.size, t);
+    }
+
+    t.back_bytes = back_consumed(t, fuzz_data);
+
+    // Will either trim if too long, or pad with zeroes
+    message_resize(mach_msg, msg_size);
+
+    // TRAILER
+    message_put_trailer(mach_msg);
+
+    // Satisfy the routine's branch conditions
+    apply_fixups(layout, mach_msg);
+}
@@ -0,0 +1,63 @@
+/* 
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef MESSAGE_GENERATOR_H
+#define MESSAGE_GENERATOR_H
+
+#include "harness.h"
+#include "message_layout.h"
+#include "message_writer.h"
+#include "resource_pool.h"
+
+#include <vector>
+
+// Valid values for property selectors, scopes, and elements
+extern const std::vector<uint32_t> kValidSelectors;
+extern const std::vector<uint32_t> kValidScopes;
+extern const std::vector<uint32_t> kValidElements;
+
+// Where a generated message came from in the fuzz input. FuzzedDataProvider
+// takes data from the front of the input and integers from the back, so each
+// message is made of two runs of bytes. Offsets count the bytes consumed from
+// that end before the field, from the start of generate_message().
+typedef struct {
+    uint32_t input_size;                // remaining_bytes() at the start
+    uint32_t front_bytes;
+    uint32_t back_bytes;
+    // The selector coin (8 bytes) and, if it came up, the three choices (1
+    // byte each). Consumed last, so these are the lowest bytes of the back run.
+    uint32_t selector_bytes;
+    // OOL descriptors whose data came from the input in full
+    uint32_t ool_count;
+    struct {
+        uint32_t size_offset;           // 2 byte planned size, back
+        uint32_t data_offset;           // front
+        uint32_t data_size;
+    } ool[MAX_LAYOUT_DESCRIPTORS];
+} message_trace_t;
+
+// The message ID for the next message in an input. The first is always
+// XSystem_Open and doesn't consume any input.
+uint32_t consume_message_id(FuzzedDataProvider& fuzz_data, bool first);
+
+// Build one Mach message for msg_id from the fuzz input into mach_msg,
+// following the message's record in kMessageLayouts. OOL buffers and ports
+// come from the resource pool and are recorded in resources, which must be
+// handed back with pool_release() once the message has been processed.
+// If trace is given, it records which input bytes went where.
+void generate_message(uint32_t msg_id, FuzzedDataProvider& fuzz_data, message_buffer_t& mach_msg, message_resources_t& resources, message_trace_t *trace = NULL);
+
+#endif // MESSAGE_GENERATOR_H
@@ -0,0 +1,346 @@
+/* 
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef MESSAGE_LAYOUT_H
+#define MESSAGE_LAYOUT_H
+
+#include "mach_compat.h"
+#include "message.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+
+// Compile-time description of every MIG routine the harness knows about.
+//
+// Each record says how big the message is, which descriptors it carries, and
+// which bytes have to be patched after generation to get past the routine's
+// validation (descriptor type/disposition checks, size fields that have to
+// agree with the OOL descriptor, ...). generate_message() in
+// message_generator.cc interprets these records. Supporting a new routine is
+// a matter of adding a line to kMessageLayouts below.
+
+#define MAX_LAYOUT_DESCRIPTORS 4
+#define MAX_LAYOUT_FIXUPS 4
+
+const uint32_t kFirstMessageId = XSystem_Open;
+const uint32_t kLastMessageId = XSystem_OpenWithBundleIDLinkageAndKindAndSynchronousGroupPropertiesAndShmemAndTimeout;
+const uint32_t kMessageIdCount = kLastMessageId - kFirstMessageId + 1;
+
+// What to put in the buffer behind an OOL memory descriptor
+typedef enum : uint8_t {
+    OOL_PAYLOAD_NONE = 0,       // No OOL memory descriptors
+    OOL_PAYLOAD_RAW,            // Bytes from the fuzz input
+    OOL_PAYLOAD_PLIST_OR_RAW,   // Coin flip between the canned plist and fuzz input bytes
+} ool_payload_kind_t;
+
+typedef enum : uint8_t {
+    FIXUP_NONE = 0,
+    FIXUP_SET_U8,       // msg[offset] = value
+    FIXUP_SET_U16,      // *(uint16_t *)&msg[offset] = value
+    FIXUP_COPY_U32,     // *(uint32_t *)&msg[offset] = *(uint32_t *)&msg[source] >> value
+} fixup_op_t;
+
+typedef struct {
+    fixup_op_t op;
+    uint16_t offset;    // Offset from the start of the message (header included)
+    uint16_t source;
+    uint32_t value;
+} layout_fixup_t;
+
+typedef struct {
+    uint32_t msg_id;
+    uint32_t msg_size;          // 0: consume the size from the fuzz input
+    bool is_ool;                // Complex message, descriptors follow the header
+    uint8_t descriptor_count;   // 0: consume the count from the fuzz input
+    mach_msg_descriptor_type_t descriptor_types[MAX_LAYOUT_DESCRIPTORS];
+    bool has_selector;          // Last 16 body bytes hold a selector/scope/element triple
+    ool_payload_kind_t ool_payload;
+    layout_fixup_t fixups[MAX_LAYOUT_FIXUPS];
+} message_layout_t;
+
+constexpr layout_fixup_t set_u8(uint16_t offset, uint8_t value) {
+    return {FIXUP_SET_U8, offset, 0, value};
+}
+
+constexpr layout_fixup_t set_u16(uint16_t offset, uint16_t value) {
+    return {FIXUP_SET_U16, offset, 0, value};
+}
+
+// Several handlers check that a size in the body agrees with the size of an
+// OOL descriptor, sometimes scaled down to an element count.
+constexpr layout_fixup_t copy_u32(uint16_t offset, uint16_t source, uint32_t shift = 0) {
+    return {FIXUP_COPY_U32, offset, source, shift};
+}
+
+constexpr message_layout_t normal_layout(uint32_t msg_id, uint32_t msg_size, bool has_selector = false) {
+    message_layout_t layout = {};
+    layout.msg_id = msg_id;
+    layout.msg_size = msg_size;
+    layout.has_selector = has_selector;
+    return layout;
+}
+
+constexpr message_layout_t ool_layout(uint32_t msg_id, uint32_t msg_size,
+                                      std::initializer_list<mach_msg_descriptor_type_t> descriptor_types,
+                                      std::initializer_list<layout_fixup_t> fixups,
+                                      bool has_selector = false) {
+    message_layout_t layout = {};
+    layout.msg_id = msg_id;
+    layout.msg_size = msg_size;
+    layout.is_ool = true;
+    layout.has_selector = has_selector;
+
+    for (mach_msg_descriptor_type_t type : descriptor_types) {
+        if (type == MACH_MSG_OOL_DESCRIPTOR) {
+            layout.ool_payload = OOL_PAYLOAD_PLIST_OR_RAW;
+        }
+        layout.descriptor_types[layout.descriptor_count++] = type;
+    }
+
+    size_t i = 0;
+    for (const layout_fixup_t& fixup : fixups) {
+        layout.fixups[i++] = fixup;
+    }
+
+    return layout;
+}
+
+// Shorthands for the table below
+const mach_msg_descriptor_type_t PORT = MACH_MSG_PORT_DESCRIPTOR;
+const mach_msg_descriptor_type_t OOL = MACH_MSG_OOL_DESCRIPTOR;
+const bool SELECTOR = true;
+
+// Offsets of the size field of the first and second OOL descriptor (DESCRIPTOR_OFFSET_0/1)
+const uint16_t OOL_SIZE_0 = 40;
+const uint16_t OOL_SIZE_1 = 56;
+
+// One record per message ID, in message ID order
+inline constexpr message_layout_t kMessageLayouts[] = {
+    ool_layout(XSystem_Open, 0x38, {PORT}, {set_u16(38, 0x11)}),
+    normal_layout(XSystem_Close, 0x18),
+    normal_layout(XSystem_GetObjectInfo, 0x24, SELECTOR),
+    ool_layout(XSystem_CreateIOContext, 0x38, {OOL}, {set_u8(39, 0x01), copy_u32(52, OOL_SIZE_0)}),
+    normal_layout(XSystem_DestroyIOContext, 0x24),
+    ool_layout(XSystem_CreateMetaDevice, 0x38, {OOL}, {set_u8(39, 0x01), copy_u32(52, OOL_SIZE_0)}),
+    normal_layout(XSystem_DestroyMetaDevice, 0x24),
+    ool_layout(XSystem_ReadSetting, 0x38, {OOL}, {set_u8(39, 0x01), copy_u32(52, OOL_SIZE_0, 1)}),
+    ool_layout(XSystem_WriteSetting, 0x4C, {OOL, OOL}, {set_u8(39, 0x01), set_u8(55, 0x01), copy_u32(68, OOL_SIZE_0, 1), copy_u32(72, OOL_SIZE_1)}),
+    ool_layout(XSystem_DeleteSetting, 0x38, {OOL}, {set_u8(39, 0x01), copy_u32(52, OOL_SIZE_0, 1)}),
+    ool_layout(XIOContext_SetClientControlPort, 0x34, {PORT}, {set_u16(38, 0x11)}),
+    ool_layout(XIOContext_Start, 0x34, {PORT}, {set_u8(38, 0x11)}),
+    normal_layout(XIOContext_Stop, 0x24),
+    normal_layout(XObject_HasProperty, 0x30),
+    normal_layout(XObject_IsPropertySettable, 0x30),
+    ool_layout(XObject_GetPropertyData, 0x48, {OOL}, {set_u8(39, 0x01), copy_u32(68, OOL_SIZE_0)}, SELECTOR),
+    normal_layout(XObject_GetPropertyData_DI32, 0x30, SELECTOR),
+    normal_layout(XObject_GetPropertyData_DI32_QI32, 0x34, SELECTOR),
+    ool_layout(XObject_GetPropertyData_DI32_QCFString, 0x48, {OOL}, {set_u8(39, 0x01), copy_u32(68, OOL_SIZE_0, 1)}, SELECTOR),
+    normal_layout(XObject_GetPropertyData_DAI32, 0x30, SELECTOR),
+    ool_layout(XObject_GetPropertyData_DAI32_QAI32, 0x48, {OOL}, {set_u8(39, 0x01), copy_u32(68, OOL_SIZE_0, 2)}, SELECTOR),
+    normal_layout(XObject_GetPropertyData_DCFString, 0x30, SELECTOR),
+    normal_layout(XObject_GetPropertyData_DCFString_QI32, 0x34, SELECTOR),
+    normal_layout(XObject_GetPropertyData_DF32, 0x30, SELECTOR),
+    normal_layout(XObject_GetPropertyData_DF32_QF32, 0x34, SELECTOR),
+    normal_layout(XObject_GetPropertyData_DF64, 0x30, SELECTOR),
+    normal_layout(XObject_GetPropertyData_DAF64, 0x30, SELECTOR),
+    normal_layout(XObject_GetPropertyData_DPList, 0x30, SELECTOR),
+    normal_layout(XObject_GetPropertyData_DCFURL, 0x30, SELECTOR),
+    ool_layout(XObject_SetPropertyData, 0x5C, {OOL, OOL}, {set_u8(39, 0x01), set_u8(55, 0x01), copy_u32(84, OOL_SIZE_0), copy_u32(88, OOL_SIZE_1)}, SELECTOR),
+    normal_layout(XObject_SetPropertyData_DI32, 0x34, SELECTOR),
+    normal_layout(XObject_SetPropertyData_DF32, 0x34, SELECTOR),
+    normal_layout(XObject_SetPropertyData_DF64, 0x38, SELECTOR),
+    ool_layout(XObject_SetPropertyData_DCFString, 0x48, {OOL}, {set_u8(39, 0x01), copy_u32(68, OOL_SIZE_0, 1)}, SELECTOR),
+    ool_layout(XObject_SetPropertyData_DPList, 0x48, {OOL}, {set_u8(39, 0x01), copy_u32(68, OOL_SIZE_0)}, SELECTOR),
+    normal_layout(XObject_AddPropertyListener, 0x30),
+    normal_layout(XObject_RemovePropertyListener, 0x30),
+    ool_layout(XSystem_OpenWithBundleID, 0x4C, {PORT, OOL}, {set_u8(38, 0x11), set_u8(51, 0x01), copy_u32(72, 52, 1)}),
+    ool_layout(XTransportManager_CreateDevice, 0x3C, {OOL}, {set_u8(39, 0x01), copy_u32(56, OOL_SIZE_0)}),
+    normal_layout(XTransportManager_DestroyDevice, 0x28),
+    ool_layout(XObject_GetPropertyData_DCFString_QRaw, 0x48, {OOL}, {set_u8(39, 0x01), copy_u32(68, OOL_SIZE_0)}, SELECTOR),
+    ool_layout(XObject_GetPropertyData_DCFString_QCFString, 0x48, {OOL}, {set_u8(39, 0x01), copy_u32(68, OOL_SIZE_0, 1)}, SELECTOR),
+    ool_layout(XObject_GetPropertyData_DCFString_QPList, 0x48, {OOL}, {set_u8(39, 0x01), copy_u32(68, OOL_SIZE_0)}, SELECTOR),
+    ool_layout(XObject_GetPropertyData_DPList_QRaw, 0x48, {OOL}, {set_u8(39, 0x01), copy_u32(68, OOL_SIZE_0)}, SELECTOR),
+    ool_layout(XObject_GetPropertyData_DPList_QCFString, 0x48, {OOL}, {set_u8(39, 0x01), copy_u32(68, OOL_SIZE_0, 1)}, SELECTOR),
+    ool_layout(XObject_GetPropertyData_DPList_QPList, 0x48, {OOL}, {set_u8(39, 0x01), copy_u32(68, OOL_SIZE_0)}, SELECTOR),
+    ool_layout(XObject_SetPropertyData_DAI32, 0x48, {OOL}, {set_u8(39, 0x01), copy_u32(68, OOL_SIZE_0, 2)}, SELECTOR),
+    ool_layout(XObject_SetPropertyData_DCFString_QRaw, 0x5C, {OOL, OOL}, {set_u8(39, 0x01), set_u8(55, 0x01), copy_u32(84, OOL_SIZE_0), copy_u32(88, OOL_SIZE_1, 1)}, SELECTOR),
+    ool_layout(XObject_SetPropertyData_DCFString_QCFString, 0x5C, {OOL, OOL}, {set_u8(39, 0x01), set_u8(55, 0x01), copy_u32(84, OOL_SIZE_0, 1), copy_u32(88, OOL_SIZE_1, 1)}, SELECTOR),
+    ool_layout(XObject_SetPropertyData_DCFString_QPList, 0x5C, {OOL, OOL}, {set_u8(39, 0x01), set_u8(55, 0x01), copy_u32(84, OOL_SIZE_0), copy_u32(88, OOL_SIZE_1, 1)}, SELECTOR),
+    ool_layout(XObject_SetPropertyData_DPList_QRaw, 0x5C, {OOL, OOL}, {set_u8(39, 0x01), set_u8(55, 0x01), copy_u32(84, OOL_SIZE_0), copy_u32(88, OOL_SIZE_1, 1)}, SELECTOR),
+    ool_layout(XObject_SetPropertyData_DPList_QCFString, 0x5C, {OOL, OOL}, {set_u8(39, 0x01), set_u8(55, 0x01), copy_u32(84, OOL_SIZE_0, 1), copy_u32(88, OOL_SIZE_1)}, SELECTOR),
+    ool_layout(XObject_SetPropertyData_DPList_QPList, 0x5C, {OOL, OOL}, {set_u8(39, 0x01), set_u8(55, 0x01), copy_u32(84, OOL_SIZE_0), copy_u32(88, OOL_SIZE_1, 1)}, SELECTOR),
+    ool_layout(XSystem_OpenWithBundleIDAndLinkage, 0x54, {PORT, OOL}, {set_u8(38, 0x11), set_u8(51, 0x01)}),
+    ool_layout(XIOContext_StartAtTime, 0x3C, {PORT}, {set_u8(38, 0x11)}),
+    normal_layout(XObject_GetPropertyData_DAI64, 0x30, SELECTOR),
+    ool_layout(XObject_GetPropertyData_DAI64_QAI64, 0x48, {OOL}, {set_u8(39, 0x01), copy_u32(68, OOL_SIZE_0, 3)}, SELECTOR),
+    ool_layout(XObject_SetPropertyData_DAI64, 0x48, {OOL}, {set_u8(39, 0x01), copy_u32(68, OOL_SIZE_0, 3)}, SELECTOR),
+    ool_layout(XIOContext_Start_With_WorkInterval, 0x34, {PORT}, {set_u16(38, 0x11)}),
+    normal_layout(XIOContext_Fetch_Workgroup_Port, 0x24),
+    ool_layout(XSystem_OpenWithBundleIDLinkageAndKind, 0x58, {PORT, OOL}, {set_u16(38, 0x11), set_u8(51, 0x01), copy_u32(80, 52, 1)}),
+    ool_layout(XSystem_OpenWithBundleIDLinkageAndKindAndSynchronousGroupProperties, 0x58, {PORT, OOL}, {set_u8(38, 0x11), set_u8(51, 0x01), copy_u32(80, 52, 1)}),
+    ool_layout(XSystem_OpenWithBundleIDLinkageAndKindAndShmem, 0x58, {PORT, OOL}, {set_u8(38, 0x11), set_u8(51, 0x01), copy_u32(80, 52, 1)}),
+    ool_layout(XIOContext_Start_Shmem, 0x34, {PORT}, {set_u16(38, 0x11)}),
+    ool_layout(XIOContext_StartAtTime_Shmem, 0x3C, {PORT}, {set_u8(38, 0x11)}),
+    ool_layout(XIOContext_Start_With_WorkInterval_Shmem, 0x34, {PORT}, {set_u16(38, 0x11)}),
+    ool_layout(XSystem_OpenWithBundleIDLinkageAndKindAndSynchronousGroupPropertiesAndShmem, 0x58, {PORT, OOL}, {set_u8(38, 0x11), set_u8(51, 0x01), copy_u32(80, 52, 1)}),
+    normal_layout(XIOContext_WaitForTap, 0x24),
+    normal_layout(XIOContext_StopWaitingForTap, 0x24),
+    ool_layout(XIOContext_Start_With_Shmem_SemaphoreTimeout, 0x4C, {PORT, PORT, PORT}, {set_u16(38, 0x11)}),
+    ool_layout(XIOContext_StartAtTime_With_Shmem_SemaphoreTimeout, 0x54, {PORT, PORT, PORT}, {set_u8(38, 0x11), set_u8(50, 0x11), set_u8(62, 0x11)}),
+    ool_layout(XSystem_OpenWithBundleIDLinkageAndKindAndSynchronousGroupPropertiesAndShmemAndTimeout, 0x58, {PORT, OOL}, {set_u8(38, 0x11), set_u8(51, 0x01), copy_u32(80, 52, 1)}),
+};
+
+// Used for message IDs outside the table: everything comes from the fuzz input
+inline constexpr message_layout_t kDefaultMessageLayout = normal_layout(0, 0);
+
+constexpr bool layouts_are_consistent() {
+    for (uint32_t i = 0; i < kMessageIdCount; i++) {
+        const message_layout_t& layout = kMessageLayouts[i];
+        if (layout.msg_id != kFirstMessageId + i) {
+            return false;
+        }
+        for (const layout_fixup_t& fixup : layout.fixups) {
+            if (fixup.op != FIXUP_NONE && fixup.offset + sizeof(uint32_t) > layout.msg_size) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static_assert(sizeof(kMessageLayouts) / sizeof(kMessageLayouts[0]) == kMessageIdCount, "missing message layouts");
+static_assert(layouts_are_consistent(), "message layouts out of order or fixups past the end of the message");
+
+inline const message_layout_t& message_layout_for(uint32_t msg_id) {
+    uint32_t index = msg_id - kFirstMessageId;
+    return index < kMessageIdCount ? kMessageLayouts[index] : kDefaultMessageLayout;
+}
+
+// What kind of object a routine's object ID has to refer to for the handler
+// to get past its object lookup
+typedef enum : uint8_t {
+    OBJECT_NONE = 0,            // The routine takes no object ID
+    OBJECT_ANY,
+    OBJECT_SYSTEM,
+    OBJECT_IO_CONTEXT,
+    OBJECT_META_DEVICE,
+    OBJECT_DEVICE,
+    OBJECT_TRANSPORT_MANAGER,
+} object_kind_t;
+
+constexpr object_kind_t object_kind_for(uint32_t msg_id) {
+    switch (msg_id) {
+        case XSystem_Open:
+        case XSystem_Close:
+        case XSystem_CreateIOContext:
+        case XSystem_CreateMetaDevice:
+        case XSystem_ReadSetting:
+        case XSystem_WriteSetting:
+        case XSystem_DeleteSetting:
+        case XSystem_OpenWithBundleID:
+        case XSystem_OpenWithBundleIDAndLinkage:
+        case XSystem_OpenWithBundleIDLinkageAndKind:
+        case XSystem_OpenWithBundleIDLinkageAndKindAndSynchronousGroupProperties:
+        case XSystem_OpenWithBundleIDLinkageAndKindAndShmem:
+        case XSystem_OpenWithBundleIDLinkageAndKindAndSynchronousGroupPropertiesAndShmem:
+        case XSystem_OpenWithBundleIDLinkageAndKindAndSynchronousGroupPropertiesAndShmemAndTimeout:
+            return OBJECT_NONE;
+        case XSystem_DestroyIOContext:
+        case XIOContext_SetClientControlPort:
+        case XIOContext_Start:
+        case XIOContext_Stop:
+        case XIOContext_StartAtTime:
+        case XIOContext_Start_With_WorkInterval:
+        case XIOContext_Fetch_Workgroup_Port:
+        case XIOContext_Start_Shmem:
+        case XIOContext_StartAtTime_Shmem:
+        case XIOContext_Start_With_WorkInterval_Shmem:
+        case XIOContext_WaitForTap:
+        case XIOContext_StopWaitingForTap:
+        case XIOContext_Start_With_Shmem_SemaphoreTimeout:
+        case XIOContext_StartAtTime_With_Shmem_SemaphoreTimeout:
+            return OBJECT_IO_CONTEXT;
+        case XSystem_DestroyMetaDevice:
+            return OBJECT_META_DEVICE;
+        case XTransportManager_CreateDevice:
+        case XTransportManager_DestroyDevice:
+            return OBJECT_TRANSPORT_MANAGER;
+        default:
+            // XSystem_GetObjectInfo and the XObject_* routines take any object
+            return msg_id - kFirstMessageId < kMessageIdCount ? OBJECT_ANY : OBJECT_NONE;
+    }
+}
+
+// The kind of object a successful msg_id creates first
+constexpr object_kind_t created_object_kind(uint32_t msg_id) {
+    switch (msg_id) {
+        case XSystem_CreateIOContext:
+            return OBJECT_IO_CONTEXT;
+        case XSystem_CreateMetaDevice:
+            return OBJECT_META_DEVICE;
+        case XTransportManager_CreateDevice:
+            return OBJECT_DEVICE;
+        default:
+            return OBJECT_ANY;
+    }
+}
+
+// MIG puts the object ID first in the body, after the descriptors and the
+// NDR record
+const uint32_t NDR_RECORD_SIZE = 8;
+
+constexpr uint32_t object_id_offset(const message_layout_t& layout) {
+    uint32_t offset = sizeof(mach_msg_header_t);
+    if (layout.is_ool) {
+        offset += sizeof(uint32_t);
+        for (uint32_t i = 0; i < layout.descriptor_count; i++) {
+            offset += layout.descriptor_types[i] == MACH_MSG_PORT_DESCRIPTOR ? sizeof(mach_msg_port_descriptor_t)
+                                                                              : sizeof(mach_msg_ool_descriptor_t);
+        }
+    }
+    return offset + NDR_RECORD_SIZE;
+}
+
+constexpr bool object_ids_fit() {
+    for (const message_layout_t& layout : kMessageLayouts) {
+        if (object_kind_for(layout.msg_id) != OBJECT_NONE && object_id_offset(layout) + sizeof(uint32_t) > layout.msg_size) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(object_ids_fit(), "object ID past the end of the message");
+
+// The return code of a reply. Complex replies carry descriptors instead of a
+// return code and are only sent on success. False if the reply is too short
+// to have one.
+inline bool reply_ret_code(const mach_msg_header_t *reply, int32_t *ret_code) {
+    const size_t ret_code_offset = sizeof(mach_msg_header_t) + NDR_RECORD_SIZE;
+    if (reply->msgh_bits & MACH_MSGH_BITS_COMPLEX) {
+        *ret_code = 0;
+        return true;
+    }
+    if (reply->msgh_size < ret_code_offset + sizeof(int32_t)) {
+        return false;
+    }
+    memcpy(ret_code, (const uint8_t *)reply + ret_code_offset, sizeof(int32_t));
+    return true;
+}
+
+#endif // MESSAGE_LAYOUT_H
@@ -0,0 +1,168 @@
+/* 
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "message_stats.h"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Rounded up to whole pages, mmap would anyway
+#define STATS_MAP_SIZE ((sizeof(stats_page_t) + 4095) & ~(size_t)4095)
+
+static stats_page_t local_page;
+static stats_page_t *page = &local_page;
+
+static bool header_matches(const stats_page_t *stats) {
+    return stats->magic == STATS_MAGIC && stats->version == STATS_VERSION &&
+           stats->message_id_count == kMessageIdCount && stats->clock == STATS_CLOCK;
+}
+
+static void init_page(stats_page_t *stats) {
+    memset((void *)stats, 0, sizeof(stats_page_t));
+    stats->version = STATS_VERSION;
+    stats->message_id_count = kMessageIdCount;
+    stats->clock = STATS_CLOCK;
+    // Last, so a reader never takes a half written page for a valid one
+    std::atomic_thread_fence(std::memory_order_release);
+    stats->magic = STATS_MAGIC;
+}
+
+stats_page_t *message_stats_page(void) {
+    if (page == &local_page && !header_matches(page)) {
+        init_page(page);
+    }
+    return page;
+}
+
+void message_stats_reset(void) {
+    init_page(message_stats_page());
+}
+
+bool message_stats_map(const char *name) {
+    int fd = shm_open(name, O_RDWR | O_CREAT, S_IRUSR | S_IWUSR);
+    if (fd == -1) {
+        perror("Error in shm_open");
+        return false;
+    }
+
+    // Only grows a new object, an existing one keeps its contents
+    struct stat st;
+    if (fstat(fd, &st) == -1 || ((size_t)st.st_size < STATS_MAP_SIZE && ftruncate(fd, STATS_MAP_SIZE) == -1)) {
+        perror("Error sizing stats page");
+        close(fd);
+        return false;
+    }
+
+    void *shm = mmap(NULL, STATS_MAP_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (shm == MAP_FAILED) {
+        perror("Error in mmap");
+        return false;
+    }
+
+    stats_page_t *stats = (stats_page_t *)shm;
+    if (!header_matches(stats)) {
+        init_page(stats);
+    }
+    page = stats;
+    return true;
+}
+
+const stats_page_t *message_stats_open(const char *name) {
+    int fd = shm_open(name, O_RDONLY, 0);
+    if (fd == -1) {
+        return NULL;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) == -1 || (size_t)st.st_size < sizeof(stats_page_t)) {
+        close(fd);
+        return NULL;
+    }
+
+    void *shm = mmap(NULL, STATS_MAP_SIZE, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (shm == MAP_FAILED) {
+        return NULL;
+    }
+
+    const stats_page_t *stats = (const stats_page_t *)shm;
+    if (!header_matches(stats)) {
+        munmap(shm, STATS_MAP_SIZE);
+        return NULL;
+    }
+    return stats;
+}
+
+void message_stats_input(void) {
+    message_stats_page()->inputs.fetch_add(1, std::memory_order_relaxed);
+}
+
+static void count_ret_code(message_stats_t& stats, int32_t ret_code) {
+    if (ret_code == 0) {
+        stats.ret_code_counts[0].fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    // Claim a free slot for a new code, 0 marks them free
+    for (uint32_t i = 1; i < STATS_RET_CODES; i++) {
+        int32_t slot = stats.ret_codes[i].load(std::memory_order_relaxed);
+        if (slot == 0) {
+            int32_t expected = 0;
+            if (stats.ret_codes[i].compare_exchange_strong(expected, ret_code, std::memory_order_relaxed)) {
+                slot = ret_code;
+            } else {
+                slot = expected;
+            }
+        }
+        if (slot == ret_code) {
+            stats.ret_code_counts[i].fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+    stats.ret_code_counts[STATS_RET_CODES].fetch_add(1, std::memory_order_relaxed);
+}
+
+void message_stats_record(uint32_t msg_id, uint64_t result, const mach_msg_header_t *reply, uint64_t ticks) {
+    stats_page_t *stats_page = message_stats_page();
+    uint32_t index = msg_id - kFirstMessageId;
+    if (index >= kMessageIdCount) {
+        stats_page->unknown_ids.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    message_stats_t& stats = stats_page->messages[index];
+    stats.calls.fetch_add(1, std::memory_order_relaxed);
+    stats.ticks.fetch_add(ticks, std::memory_order_relaxed);
+
+    uint32_t bucket = ticks ? 63 - __builtin_clzll(ticks) : 0;
+    if (bucket >= STATS_TICK_BUCKETS) bucket = STATS_TICK_BUCKETS - 1;
+    stats.tick_histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+
+    if (!result) {
+        stats.unhandled.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    int32_t ret_code;
+    if (reply_ret_code(reply, &ret_code)) {
+        count_ret_code(stats, ret_code);
+    } else {
+        stats.no_ret_code.fetch_add(1, std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,125 @@
+/* 
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef MESSAGE_STATS_H
+#define MESSAGE_STATS_H
+
+#include "message_layout.h"
+
+#include <atomic>
+#include <time.h>
+#if defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+
+// Per routine counters around Mach_Processing_Function: how often each msg_id
+// is sent, what it returns and how long the server takes on it. They are
+// always on and live in a stats page, private to the process unless
+// message_stats_map() put it in shared memory (harness -s name), where
+// tools/read_stats.cc reads it while the fuzzer runs.
+//
+// Harnesses that share a name add to the same page, and it carries over
+// restarts. Counters are updated with relaxed atomics and read without
+// stopping anyone, so a reader may see a call counted before its time is.
+
+#define STATS_MAGIC 'msts'
+#define STATS_VERSION 1
+
+// Bucket n counts calls that took [2^n, 2^(n+1)) clock ticks
+#define STATS_TICK_BUCKETS 40
+
+// Return codes told apart per routine. Slot 0 is always KERN_SUCCESS, the
+// others go to the first codes seen; the rest are counted as other.
+#define STATS_RET_CODES 8
+
+// What stats_clock() counts
+#define STATS_CLOCK_TSC 0               // x86_64 time stamp counter
+#define STATS_CLOCK_CNTVCT 1            // arm64 generic timer (cntvct_el0), 24 MHz on Apple silicon
+#define STATS_CLOCK_NS 2                // clock_gettime
+
+typedef struct {
+    std::atomic<uint64_t> calls;
+    std::atomic<uint64_t> unhandled;    // Mach_Processing_Function returned false
+    std::atomic<uint64_t> ticks;
+    std::atomic<uint64_t> tick_histogram[STATS_TICK_BUCKETS];
+    std::atomic<int32_t> ret_codes[STATS_RET_CODES];
+    std::atomic<uint64_t> ret_code_counts[STATS_RET_CODES + 1];  // the last one counts other codes
+    std::atomic<uint64_t> no_ret_code;  // replies too short to have one
+} message_stats_t;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t message_id_count;
+    uint32_t clock;
+    std::atomic<uint64_t> inputs;
+    std::atomic<uint64_t> unknown_ids;  // messages outside the layout table
+    message_stats_t messages[kMessageIdCount];
+} stats_page_t;
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "Stats need lock free atomics across processes");
+
+inline uint64_t stats_clock(void) {
+#if defined(__x86_64__)
+#define STATS_CLOCK STATS_CLOCK_TSC
+    return __rdtsc();
+#elif defined(__aarch64__) || defined(__arm64__)
+#define STATS_CLOCK STATS_CLOCK_CNTVCT
+    uint64_t ticks;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+    return ticks;
+#else
+#define STATS_CLOCK STATS_CLOCK_NS
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+#endif
+}
+
+// Ticks per second of stats_clock(), 0 if the hardware doesn't say (the TSC)
+inline uint64_t stats_clock_frequency(void) {
+#if STATS_CLOCK == STATS_CLOCK_CNTVCT
+    uint64_t frequency;
+    asm volatile("mrs %0, cntfrq_el0" : "=r"(frequency));
+    return frequency;
+#elif STATS_CLOCK == STATS_CLOCK_NS
+    return 1000000000;
+#else
+    return 0;
+#endif
+}
+
+// Move the stats to the shared memory object name, creating it or adding to
+// what is there. False on failure, the stats stay where they were.
+bool message_stats_map(const char *name);
+
+// Reader side: the stats page of a running harness, read only. NULL if there
+// is none or it comes from a different build.
+const stats_page_t *message_stats_open(const char *name);
+
+stats_page_t *message_stats_page(void);
+
+// Forget everything counted so far
+void message_stats_reset(void);
+
+// Called once per input
+void message_stats_input(void);
+
+// Called with the reply once msg_id was processed, result being what
+// Mach_Processing_Function returned
+void message_stats_record(uint32_t msg_id, uint64_t result, const mach_msg_header_t *reply, uint64_t ticks);
+
+#endif // MESSAGE_STATS_H
@@ -0,0 +1,40 @@
+/* 
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "message_writer.h"
+
+static standard_trailer_t make_standard_trailer() {
+    standard_trailer_t trailer = {};
+    trailer.msg_trailer_size = 32;
+    trailer.msg_audit = safari_audit_token;
+    return trailer;
+}
+
+void message_put_trailer(message_buffer_t& msg) {
+    // Built on first use, after the constructor has looked up the audit token
+    static const standard_trailer_t trailer = make_standard_trailer();
+    message_put(msg, trailer);
+}
+
+message_buffer_t& thread_message_buffer() {
+    static thread_local message_buffer_t buffer;
+    return buffer;
+}
+
+mach_msg_header_t *thread_return_buffer() {
+    alignas(16) static thread_local uint8_t buffer[RETURN_BUFFER_SIZE];
+    return reinterpret_cast<mach_msg_header_t *>(buffer);
+}
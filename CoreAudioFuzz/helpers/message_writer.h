@@ -0,0 +1,83 @@
+/* 
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef MESSAGE_WRITER_H
+#define MESSAGE_WRITER_H
+
+#include "harness.h"
+#include "message_layout.h"
+
+#include <cstring>
+
+// Messages are serialised straight into a fixed, reused buffer rather than
+// assembled from temporary vectors. Nothing on this path allocates.
+
+// Largest message we can produce: the header, descriptor count and the most
+// descriptors a message can carry may run past a small fuzzed msgh_size
+// before the message is trimmed, then the trailer follows.
+#define MESSAGE_BUFFER_SIZE (MAX_MESSAGE_SIZE + sizeof(uint32_t) + MAX_LAYOUT_DESCRIPTORS * sizeof(mach_msg_ool_descriptor_t) + MACH_MSG_TRAILER_SIZE)
+#define RETURN_BUFFER_SIZE (sizeof(mach_msg_header_t) + 10000) // Arbitrary at this point
+
+typedef struct {
+    alignas(16) uint8_t data[MESSAGE_BUFFER_SIZE];
+    uint32_t size;
+} message_buffer_t;
+
+// The trailer the kernel appends on receive. Only the audit token varies,
+// and only once at start up.
+typedef struct __attribute__((packed)) {
+    uint32_t msg_trailer_type;
+    uint32_t msg_trailer_size;
+    uint32_t msg_seqno;
+    uint64_t msg_sender;
+    audit_token_t msg_audit;
+} standard_trailer_t;
+
+static_assert(sizeof(standard_trailer_t) == MACH_MSG_TRAILER_SIZE, "unexpected trailer layout");
+
+inline void message_reset(message_buffer_t& msg) {
+    msg.size = 0;
+}
+
+template <typename T>
+inline void message_put(message_buffer_t& msg, const T& value) {
+    memcpy(msg.data + msg.size, &value, sizeof(T));
+    msg.size += sizeof(T);
+}
+
+// Append up to count bytes of fuzz input. Like ConsumeBytes, this comes up
+// short once the input runs out.
+inline size_t message_put_input(message_buffer_t& msg, FuzzedDataProvider& fuzz_data, size_t count) {
+    size_t consumed = fuzz_data.ConsumeData(msg.data + msg.size, count);
+    msg.size += consumed;
+    return consumed;
+}
+
+// Trim, or pad with zeroes
+inline void message_resize(message_buffer_t& msg, uint32_t size) {
+    if (size > msg.size) {
+        memset(msg.data + msg.size, 0, size - msg.size);
+    }
+    msg.size = size;
+}
+
+void message_put_trailer(message_buffer_t& msg);
+
+// Per-thread buffers, reused for every message
+message_buffer_t& thread_message_buffer();
+mach_msg_header_t *thread_return_buffer();
+
+#endif // MESSAGE_WRITER_H
@@ -0,0 +1,257 @@
+/* 
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "object_tracker.h"
+
+#include <cstring>
+
+// How the low byte of the object ID in the fuzz input picks where the ID
+// comes from: below TRACKED_LIMIT it's a tracked object, below PROBE_LIMIT
+// it's any ID the server has handed out (objects that existed before we
+// started, or that the tracker evicted), otherwise it stays. Zeroes, common
+// in the corpus, pick a tracked object.
+#define TRACKED_LIMIT 208
+#define PROBE_LIMIT 240
+
+bool object_tracking = true;
+
+static tracked_object_t objects[MAX_TRACKED_OBJECTS] = {{SYSTEM_OBJECT_ID, 'asys', OBJECT_SYSTEM}};
+static size_t object_count = 1;
+static size_t next_eviction = 1;
+static uint64_t last_next_object_id = 0;
+static object_tracker_stats_t stats;
+
+void object_tracker_reset(void) {
+    objects[0] = {SYSTEM_OBJECT_ID, 'asys', OBJECT_SYSTEM};
+    object_count = 1;
+    next_eviction = 1;
+    last_next_object_id = 0;
+    stats = {};
+}
+
+size_t object_tracker_count(void) {
+    return object_count;
+}
+
+const tracked_object_t *object_tracker_objects(void) {
+    return objects;
+}
+
+const object_tracker_stats_t& object_tracker_stats(void) {
+    return stats;
+}
+
+static tracked_object_t *find_object(uint32_t object_id) {
+    for (size_t i = 0; i < object_count; i++) {
+        if (objects[i].object_id == object_id) {
+            return &objects[i];
+        }
+    }
+    return NULL;
+}
+
+static tracked_object_t *add_object(uint32_t object_id, object_kind_t kind) {
+    tracked_object_t *object = find_object(object_id);
+    if (object) {
+        return object;
+    }
+
+    // Once full, overwrite the oldest entries. The system object stays.
+    if (object_count < MAX_TRACKED_OBJECTS) {
+        object = &objects[object_count++];
+    } else {
+        object = &objects[next_eviction];
+        next_eviction = next_eviction + 1 < MAX_TRACKED_OBJECTS ? next_eviction + 1 : 1;
+    }
+
+    *object = {object_id, 0, kind};
+    return object;
+}
+
+static bool remove_object(uint32_t object_id) {
+    tracked_object_t *object = find_object(object_id);
+    if (!object || object_id == SYSTEM_OBJECT_ID) {
+        return false;
+    }
+
+    *object = objects[--object_count];
+    if (next_eviction >= object_count) {
+        next_eviction = 1;
+    }
+    return true;
+}
+
+// Classes that pin down what an object can be used for
+static object_kind_t kind_for_class(uint32_t object_class, uint32_t base_class) {
+    switch (object_class) {
+        case 'asys':
+            return OBJECT_SYSTEM;
+        case 'aagg':
+            return OBJECT_META_DEVICE;
+        case 'adev':
+        case 'asub':
+            return OBJECT_DEVICE;
+        case 'trpm':
+            return OBJECT_TRANSPORT_MANAGER;
+        default:
+            return base_class == 'adev' ? OBJECT_DEVICE : OBJECT_ANY;
+    }
+}
+
+// The n'th tracked object of the given kind, or of any kind if there is none
+static uint32_t pick_object(object_kind_t kind, uint32_t n) {
+    size_t matching = 0;
+    if (kind != OBJECT_ANY) {
+        for (size_t i = 0; i < object_count; i++) {
+            matching += objects[i].kind == kind;
+        }
+    }
+
+    if (matching == 0) {
+        return objects[n % object_count].object_id;
+    }
+
+    n %= matching;
+    for (size_t i = 0; i < object_count; i++) {
+        if (objects[i].kind == kind && n-- == 0) {
+            return objects[i].object_id;
+        }
+    }
+    return SYSTEM_OBJECT_ID;
+}
+
+// Where the object ID of msg_id is in request, or 0 if the server won't get
+// that far: the header it parses names another routine, or the message is
+// too short.
+static uint32_t object_id_offset_in(uint32_t msg_id, const mach_msg_header_t *request) {
+    if ((uint32_t)request->msgh_id != msg_id || object_kind_for(msg_id) == OBJECT_NONE) {
+        return 0;
+    }
+
+    uint32_t offset = object_id_offset(message_layout_for(msg_id));
+    if (offset + sizeof(uint32_t) > request->msgh_size) {
+        return 0;
+    }
+    return offset;
+}
+
+void object_tracker_apply(uint32_t msg_id, message_buffer_t& mach_msg) {
+    // So objects created by the very first message are seen
+    if (NextObjectID && !last_next_object_id) {
+        last_next_object_id = *NextObjectID;
+    }
+
+    if (!object_tracking) {
+        return;
+    }
+
+    uint32_t offset = object_id_offset_in(msg_id, (const mach_msg_header_t *)mach_msg.data);
+    if (!offset) {
+        return;
+    }
+
+    uint32_t raw;
+    memcpy(&raw, mach_msg.data + offset, sizeof(uint32_t));
+
+    uint32_t choice = raw & 0xff;
+    uint32_t object_id;
+    bool can_probe = NextObjectID && *NextObjectID > SYSTEM_OBJECT_ID + 1;
+    if (choice < TRACKED_LIMIT || (choice < PROBE_LIMIT && !can_probe)) {
+        // Mostly an object the routine can use, sometimes any live one
+        object_id = pick_object((raw >> 8) & 3 ? object_kind_for(msg_id) : OBJECT_ANY, raw >> 10);
+        stats.tracked++;
+    } else if (choice < PROBE_LIMIT) {
+        object_id = SYSTEM_OBJECT_ID + (raw >> 8) % (uint32_t)(*NextObjectID - SYSTEM_OBJECT_ID);
+        stats.probed++;
+    } else {
+        stats.kept++;
+        return;
+    }
+
+    memcpy(mach_msg.data + offset, &object_id, sizeof(uint32_t));
+}
+
+void object_tracker_observe(uint32_t msg_id, const mach_msg_header_t *request, const mach_msg_header_t *reply) {
+    // Whatever sNextObjectID moved past was created by this message
+    if (NextObjectID) {
+        uint64_t next_object_id = *NextObjectID;
+        if (last_next_object_id && next_object_id > last_next_object_id) {
+            // The first one is what the routine creates, the rest (streams,
+            // controls, ...) are recorded up to the limit, newest first
+            add_object((uint32_t)last_next_object_id, created_object_kind(msg_id));
+            stats.created++;
+
+            uint64_t first = next_object_id - last_next_object_id > MAX_CREATED_PER_MESSAGE ? next_object_id - (MAX_CREATED_PER_MESSAGE - 1)
+                                                                                             : last_next_object_id + 1;
+            for (uint64_t object_id = first; object_id < next_object_id; object_id++) {
+                add_object((uint32_t)object_id, OBJECT_ANY);
+                stats.created++;
+            }
+        }
+        last_next_object_id = next_object_id;
+    }
+
+    uint32_t offset = object_id_offset_in(msg_id, request);
+    if (!offset) {
+        return;
+    }
+
+    object_kind_t kind = object_kind_for(msg_id);
+    uint32_t object_id;
+    memcpy(&object_id, (const uint8_t *)request + offset, sizeof(uint32_t));
+
+    int32_t ret_code;
+    if (!reply_ret_code(reply, &ret_code)) {
+        return;
+    }
+
+    if (ret_code == BAD_OBJECT_ERROR) {
+        // Also what a live object of the wrong kind gets
+        tracked_object_t *object = find_object(object_id);
+        if (object && (kind == OBJECT_ANY || object->kind == kind)) {
+            stats.removed += remove_object(object_id);
+        }
+        return;
+    } else if (ret_code != 0) {
+        // Failed past the object lookup, or before it: no telling
+        return;
+    }
+
+    if (msg_id == XSystem_DestroyIOContext || msg_id == XSystem_DestroyMetaDevice) {
+        stats.removed += remove_object(object_id);
+        return;
+    }
+
+    tracked_object_t *object = find_object(object_id);
+    if (!object) {
+        object = add_object(object_id, OBJECT_ANY);
+        stats.confirmed++;
+    }
+
+    // The handler accepted it, so it is what the routine wanted
+    if (object->kind == OBJECT_ANY && kind != OBJECT_ANY) {
+        object->kind = kind;
+    }
+
+    if (msg_id == XSystem_GetObjectInfo && reply->msgh_size >= OBJECT_INFO_BASE_CLASS_OFFSET + sizeof(uint32_t)) {
+        uint32_t base_class;
+        memcpy(&object->object_class, (const uint8_t *)reply + OBJECT_INFO_CLASS_OFFSET, sizeof(uint32_t));
+        memcpy(&base_class, (const uint8_t *)reply + OBJECT_INFO_BASE_CLASS_OFFSET, sizeof(uint32_t));
+        if (object->kind == OBJECT_ANY) {
+            object->kind = kind_for_class(object->object_class, base_class);
+        }
+    }
+}
@@ -0,0 +1,83 @@
+/* 
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef OBJECT_TRACKER_H
+#define OBJECT_TRACKER_H
+
+#include "message_writer.h"
+
+// Object IDs the audio server is known to have live.
+//
+// Object IDs taken straight from the fuzz input almost never name an object,
+// so most XObject_* and XIOContext_* messages are turned away by the object
+// lookup at the top of their handler. The tracker watches replies and
+// sNextObjectID (NextObjectID) to learn which objects exist, and rewrites the
+// object ID of outgoing messages to one of them most of the time.
+//
+// Server objects outlive inputs, so the tracker isn't reset between them.
+
+#define MAX_TRACKED_OBJECTS 256
+
+// A message that moves sNextObjectID further than this (an aggregate device
+// and all its streams and controls, say) only has the object it created and
+// its last ones recorded
+#define MAX_CREATED_PER_MESSAGE 16
+
+#define SYSTEM_OBJECT_ID 1              // kAudioObjectSystemObject
+#define BAD_OBJECT_ERROR '!obj'         // kAudioHardwareBadObjectError
+
+// Offsets into the reply to XSystem_GetObjectInfo
+#define OBJECT_INFO_CLASS_OFFSET 48
+#define OBJECT_INFO_BASE_CLASS_OFFSET 52
+
+typedef struct {
+    uint32_t object_id;
+    uint32_t object_class;      // 0 until XSystem_GetObjectInfo told us
+    object_kind_t kind;
+} tracked_object_t;
+
+typedef struct {
+    // How outgoing object IDs were picked
+    uint64_t kept;              // left as the fuzz input had it
+    uint64_t probed;            // some ID below sNextObjectID
+    uint64_t tracked;           // a live object
+    // What the replies told us
+    uint64_t created;
+    uint64_t confirmed;
+    uint64_t removed;
+} object_tracker_stats_t;
+
+// Rewrite object IDs at all, on by default
+extern bool object_tracking;
+
+// Forget everything but the system object
+void object_tracker_reset(void);
+
+size_t object_tracker_count(void);
+const tracked_object_t *object_tracker_objects(void);
+const object_tracker_stats_t& object_tracker_stats(void);
+
+// Called between generate_message() and sending, with the msg_id it was
+// given. Picks the message's object ID from its own bytes, so inputs still
+// decide what gets sent and nothing extra is consumed from the fuzz input.
+// Messages whose header came out shifted (the ports ran short) don't carry
+// msg_id where the server looks for it and are left alone.
+void object_tracker_apply(uint32_t msg_id, message_buffer_t& mach_msg);
+
+// Called with the reply once msg_id was processed
+void object_tracker_observe(uint32_t msg_id, const mach_msg_header_t *request, const mach_msg_header_t *reply);
+
+#endif // OBJECT_TRACKER_H
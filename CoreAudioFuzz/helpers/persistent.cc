@@ -0,0 +1,139 @@
+/* 
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "persistent.h"
+
+#include <cstring>
+#include <fcntl.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+unsigned char *persistent_map(const char *name, bool create) {
+    int fd = shm_open(name, create ? O_RDWR | O_CREAT : O_RDWR, S_IRUSR | S_IWUSR);
+    if (fd == -1) {
+        perror("Error in shm_open");
+        return NULL;
+    }
+
+    if (create && ftruncate(fd, PERSISTENT_SHM_SIZE) == -1) {
+        perror("Error in ftruncate");
+        close(fd);
+        return NULL;
+    }
+
+    void *shm = mmap(NULL, PERSISTENT_SHM_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (shm == MAP_FAILED) {
+        perror("Error in mmap");
+        return NULL;
+    }
+
+    if (create) {
+        memset(shm, 0, PERSISTENT_SHM_SIZE);
+    }
+    return (unsigned char *)shm;
+}
+
+persistent_control_t *persistent_control(unsigned char *shm) {
+    return (persistent_control_t *)(shm + SHM_SIZE);
+}
+
+// Spin briefly, as the other side usually answers within microseconds, then
+// back off to sleeping so an idle harness doesn't burn a core
+static void backoff(uint32_t round) {
+    if (round < 1000) {
+        return;
+    } else if (round < 2000) {
+        sched_yield();
+    } else {
+        struct timespec ts = {0, 50 * 1000};
+        nanosleep(&ts, NULL);
+    }
+}
+
+uint64_t persistent_loop(unsigned char *shm, const persistent_options_t& options) {
+    persistent_control_t *control = persistent_control(shm);
+    uint64_t iterations = 0;
+
+    control->iterations = 0;
+
+    for (;;) {
+        // Wait for the next sample
+        uint32_t request;
+        for (uint32_t round = 0; (request = control->request.load(std::memory_order_acquire)) ==
+                                 control->response.load(std::memory_order_relaxed); round++) {
+            backoff(round);
+        }
+
+        if (control->command == PERSISTENT_COMMAND_STOP) {
+            control->status = PERSISTENT_STATUS_OK;
+            control->response.store(request, std::memory_order_release);
+            break;
+        }
+
+        size_t size = *(uint32_t *)shm;
+        if (size > MAX_SAMPLE_SIZE) {
+            size = MAX_SAMPLE_SIZE;
+        }
+
+        // Parsed in place, the driver doesn't touch the sample until we respond
+        LLVMFuzzerTestOneInput(shm + sizeof(uint32_t), size);
+
+        if (options.reset_state) {
+            options.reset_state();
+        }
+
+        iterations++;
+        control->iterations = iterations;
+
+        bool restart = options.max_iterations != 0 && iterations >= options.max_iterations;
+        control->status = restart ? PERSISTENT_STATUS_RESTART : PERSISTENT_STATUS_OK;
+        control->response.store(request, std::memory_order_release);
+
+        if (restart) {
+            break;
+        }
+    }
+
+    verbose_print("Info: Persistent loop ran %llu inputs\n", (unsigned long long)iterations);
+    return iterations;
+}
+
+bool persistent_run(unsigned char *shm, uint32_t command, bool (*alive)(void *arg), void *arg) {
+    persistent_control_t *control = persistent_control(shm);
+
+    control->command = command;
+    uint32_t request = control->request.load(std::memory_order_relaxed) + 1;
+    control->request.store(request, std::memory_order_release);
+
+    for (uint32_t round = 0; control->response.load(std::memory_order_acquire) != request; round++) {
+        // Checking costs a syscall, only do so once we're backing off
+        if (round >= 1000 && round % 64 == 0 && !alive(arg)) {
+            // It may have answered just before exiting
+            if (control->response.load(std::memory_order_acquire) == request) {
+                return true;
+            }
+            // Don't let the next harness pick the sample up again
+            control->response.store(request, std::memory_order_relaxed);
+            return false;
+        }
+        backoff(round);
+    }
+    return true;
+}
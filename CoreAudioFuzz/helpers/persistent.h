@@ -0,0 +1,78 @@
+/* 
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef PERSISTENT_H
+#define PERSISTENT_H
+
+#include "harness.h"
+
+#include <atomic>
+
+// Persistent mode: the harness stays up with the audio server initialised and
+// runs input after input from shared memory, instead of one sample per
+// process.
+//
+// The region keeps the single-shot layout at the front, a 32-bit size followed
+// by the sample, so the sample is parsed in place in both modes. A control
+// block follows it:
+//
+//   driver:  write size and sample, then request = request + 1
+//   harness: run the sample, write status, then response = request
+//
+// The harness exits after max_iterations inputs, reporting
+// PERSISTENT_STATUS_RESTART with the last response; the driver starts a new
+// one. A harness that dies with request != response crashed on the sample.
+
+#define PERSISTENT_COMMAND_RUN 0
+#define PERSISTENT_COMMAND_STOP 1
+
+#define PERSISTENT_STATUS_OK 0
+#define PERSISTENT_STATUS_RESTART 1     // Exiting, start a new harness
+
+typedef struct {
+    std::atomic<uint32_t> request;      // Bumped by the driver for each sample
+    std::atomic<uint32_t> response;     // Set to request by the harness when done
+    uint32_t command;
+    uint32_t status;
+    uint64_t iterations;                // Inputs run by the current harness
+} persistent_control_t;
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "Handshake needs lock free atomics across processes");
+
+#define PERSISTENT_SHM_SIZE (SHM_SIZE + sizeof(persistent_control_t))
+
+typedef struct {
+    uint64_t max_iterations;            // 0 runs until told to stop
+    // Called after every input to put the process back in a known state
+    void (*reset_state)(void);
+} persistent_options_t;
+
+// Map (and with create, make and zero) a persistent mode region. Returns NULL
+// on failure.
+unsigned char *persistent_map(const char *name, bool create);
+
+persistent_control_t *persistent_control(unsigned char *shm);
+
+// Harness side: serve samples from shm until stopped or max_iterations is
+// reached. Returns the number of inputs run.
+uint64_t persistent_loop(unsigned char *shm, const persistent_options_t& options);
+
+// Driver side: hand the sample already written to shm to the harness and wait
+// for it. Returns false if alive() reports the harness gone first, i.e. it
+// crashed on the sample. alive() may also kill a harness that takes too long.
+bool persistent_run(unsigned char *shm, uint32_t command, bool (*alive)(void *arg), void *arg);
+
+#endif // PERSISTENT_H
@@ -0,0 +1,346 @@
+/* 
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "resource_pool.h"
+#include "harness.h"
+
+#include <errno.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#ifdef __APPLE__
+#include <mach/mach_vm.h>
+
+// Tag pool allocations so a region the target freed and someone else
+// reallocated at the same address isn't mistaken for ours
+#define POOL_VM_TAG VM_MEMORY_APPLICATION_SPECIFIC_1
+
+static void *mach_allocate(size_t size) {
+    vm_address_t address = 0;
+    if (vm_allocate(mach_task_self(), &address, size, VM_FLAGS_ANYWHERE | VM_MAKE_TAG(POOL_VM_TAG)) != KERN_SUCCESS) {
+        return NULL;
+    }
+    return reinterpret_cast<void *>(address);
+}
+
+static void mach_deallocate(void *buffer, size_t size) {
+    vm_deallocate(mach_task_self(), reinterpret_cast<vm_address_t>(buffer), size);
+}
+
+static bool mach_is_allocated(void *buffer, size_t size) {
+    mach_vm_address_t address = reinterpret_cast<mach_vm_address_t>(buffer);
+    mach_vm_size_t region_size = 0;
+    vm_region_extended_info_data_t info;
+    mach_msg_type_number_t count = VM_REGION_EXTENDED_INFO_COUNT;
+    mach_port_t object_name = MACH_PORT_NULL;
+
+    kern_return_t kr = mach_vm_region(mach_task_self(), &address, &region_size, VM_REGION_EXTENDED_INFO,
+                                      (vm_region_info_t)&info, &count, &object_name);
+    if (kr != KERN_SUCCESS) {
+        return false;
+    }
+
+    // mach_vm_region returns the next region if the address isn't mapped
+    return address <= reinterpret_cast<mach_vm_address_t>(buffer) &&
+           address + region_size >= reinterpret_cast<mach_vm_address_t>(buffer) + size &&
+           info.user_tag == POOL_VM_TAG &&
+           (info.protection & VM_PROT_WRITE);
+}
+
+static mach_port_t mach_create_port(void) {
+    mach_port_t port = MACH_PORT_NULL;
+    kern_return_t kr;
+
+    // Allocate a port with receive rights
+    kr = mach_port_allocate(mach_task_self(), MACH_PORT_RIGHT_RECEIVE, &port);
+    if (kr != KERN_SUCCESS) {
+        fprintf(stderr, "Failed to allocate port: %s\n", mach_error_string(kr));
+        exit(1);
+    }
+
+    // Insert a send right for the port
+    kr = mach_port_insert_right(mach_task_self(), port, port, MACH_MSG_TYPE_MAKE_SEND);
+    if (kr != KERN_SUCCESS) {
+        fprintf(stderr, "Failed to insert send right: %s\n", mach_error_string(kr));
+        exit(1);
+    }
+
+    return port;
+}
+
+static void mach_destroy_port(mach_port_t port) {
+    mach_port_mod_refs(mach_task_self(), port, MACH_PORT_RIGHT_RECEIVE, -1);
+    // Drops the send right, or the dead name if the receive right is already gone
+    mach_port_deallocate(mach_task_self(), port);
+}
+
+static bool mach_repair_port(mach_port_t port) {
+    mach_port_urefs_t refs = 0;
+
+    // Without the receive right the port is no use to us
+    if (mach_port_get_refs(mach_task_self(), port, MACH_PORT_RIGHT_RECEIVE, &refs) != KERN_SUCCESS || refs == 0) {
+        return false;
+    }
+
+    // The message moved our send right to the target
+    if (mach_port_get_refs(mach_task_self(), port, MACH_PORT_RIGHT_SEND, &refs) != KERN_SUCCESS) {
+        return false;
+    }
+    if (refs == 0 && mach_port_insert_right(mach_task_self(), port, port, MACH_MSG_TYPE_MAKE_SEND) != KERN_SUCCESS) {
+        return false;
+    }
+
+    // Nobody receives on pooled ports, so anything the target sent to one
+    // would pile up there from input to input
+    mach_port_status_t status;
+    mach_msg_type_number_t count = MACH_PORT_RECEIVE_STATUS_COUNT;
+    if (mach_port_get_attributes(mach_task_self(), port, MACH_PORT_RECEIVE_STATUS,
+                                 (mach_port_info_t)&status, &count) != KERN_SUCCESS) {
+        return false;
+    }
+    return status.mps_msgcount == 0;
+}
+
+const pool_backend_t mach_pool_backend = {
+    "mach",
+    mach_allocate,
+    mach_deallocate,
+    mach_is_allocated,
+    mach_create_port,
+    mach_destroy_port,
+    mach_repair_port,
+};
+#endif
+
+static void *mmap_allocate(size_t size) {
+    void *address = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    return address == MAP_FAILED ? NULL : address;
+}
+
+static void mmap_deallocate(void *buffer, size_t size) {
+    munmap(buffer, size);
+}
+
+static bool mmap_is_allocated(void *buffer, size_t size) {
+    // msync fails with ENOMEM on unmapped pages
+    return msync(buffer, size, MS_ASYNC) == 0 || errno != ENOMEM;
+}
+
+// Port names are only ever compared by the mock processing function
+static mach_port_t next_fake_port = 0x1003;
+
+static mach_port_t mmap_create_port(void) {
+    return next_fake_port += 4;
+}
+
+static void mmap_destroy_port(mach_port_t port) {
+    (void)port;
+}
+
+static bool mmap_repair_port(mach_port_t port) {
+    (void)port;
+    return true;
+}
+
+const pool_backend_t mmap_pool_backend = {
+    "mmap",
+    mmap_allocate,
+    mmap_deallocate,
+    mmap_is_allocated,
+    mmap_create_port,
+    mmap_destroy_port,
+    mmap_repair_port,
+};
+
+typedef struct {
+    const pool_backend_t *backend;
+    size_t buffer_size;
+    void *free_buffers[OOL_POOL_SIZE];
+    uint32_t free_buffer_count;
+    mach_port_t free_ports[PORT_POOL_SIZE];
+    uint32_t free_port_count;
+    pool_stats_t stats;
+} pool_t;
+
+static thread_local pool_t pool;
+
+static void pool_check_init() {
+    if (pool.backend == NULL) {
+#ifdef __APPLE__
+        pool_init(&mach_pool_backend);
+#else
+        pool_init(&mmap_pool_backend);
+#endif
+    }
+}
+
+void pool_init(const pool_backend_t *backend) {
+    if (pool.backend != NULL) {
+        pool_reset();
+    }
+
+    size_t page_size = getpagesize();
+    pool.backend = backend;
+    pool.buffer_size = (MAX_OOL_DATA_SIZE + page_size - 1) / page_size * page_size;
+}
+
+const pool_backend_t *pool_backend() {
+    pool_check_init();
+    return pool.backend;
+}
+
+void pool_reset() {
+    if (pool.backend == NULL) {
+        return;
+    }
+
+    while (pool.free_buffer_count > 0) {
+        pool.backend->deallocate(pool.free_buffers[--pool.free_buffer_count], pool.buffer_size);
+    }
+    while (pool.free_port_count > 0) {
+        pool.backend->destroy_port(pool.free_ports[--pool.free_port_count]);
+    }
+}
+
+size_t pool_check() {
+    if (pool.backend == NULL) {
+        return 0;
+    }
+
+    size_t dropped = 0;
+    uint32_t kept = 0;
+    for (uint32_t i = 0; i < pool.free_buffer_count; i++) {
+        void *buffer = pool.free_buffers[i];
+        if (pool.backend->is_allocated(buffer, pool.buffer_size)) {
+            pool.free_buffers[kept++] = buffer;
+        } else {
+            pool.stats.buffers_replaced++;
+            dropped++;
+        }
+    }
+    pool.free_buffer_count = kept;
+
+    kept = 0;
+    for (uint32_t i = 0; i < pool.free_port_count; i++) {
+        mach_port_t port = pool.free_ports[i];
+        if (pool.backend->repair_port(port)) {
+            pool.free_ports[kept++] = port;
+        } else {
+            pool.backend->destroy_port(port);
+            pool.stats.ports_replaced++;
+            dropped++;
+        }
+    }
+    pool.free_port_count = kept;
+
+    return dropped;
+}
+
+size_t pool_buffer_size() {
+    pool_check_init();
+    return pool.buffer_size;
+}
+
+void *pool_acquire_ool_buffer(message_resources_t& resources) {
+    pool_check_init();
+
+    if (resources.ool_buffer_count >= MAX_MESSAGE_OOL_BUFFERS) {
+        return NULL;
+    }
+
+    void *buffer;
+    if (pool.free_buffer_count > 0) {
+        buffer = pool.free_buffers[--pool.free_buffer_count];
+    } else {
+        buffer = pool.backend->allocate(pool.buffer_size);
+        if (buffer == NULL) {
+            return NULL;
+        }
+        pool.stats.buffers_allocated++;
+    }
+
+    resources.ool_buffers[resources.ool_buffer_count++] = buffer;
+    return buffer;
+}
+
+mach_port_t pool_acquire_port(message_resources_t& resources) {
+    pool_check_init();
+
+    if (resources.port_count >= MAX_MESSAGE_PORTS) {
+        return MACH_PORT_NULL;
+    }
+
+    mach_port_t port;
+    if (pool.free_port_count > 0) {
+        port = pool.free_ports[--pool.free_port_count];
+    } else {
+        port = pool.backend->create_port();
+        pool.stats.ports_created++;
+    }
+
+    resources.ports[resources.port_count++] = port;
+    return port;
+}
+
+void pool_release(message_resources_t& resources) {
+    for (uint32_t i = 0; i < resources.ool_buffer_count; i++) {
+        void *buffer = resources.ool_buffers[i];
+
+        if (!pool.backend->is_allocated(buffer, pool.buffer_size)) {
+            // The target deallocated it, the address is no longer ours
+            pool.stats.buffers_replaced++;
+            continue;
+        }
+
+        if (pool.free_buffer_count < OOL_POOL_SIZE) {
+            pool.free_buffers[pool.free_buffer_count++] = buffer;
+        } else {
+            pool.backend->deallocate(buffer, pool.buffer_size);
+        }
+    }
+
+    for (uint32_t i = 0; i < resources.port_count; i++) {
+        mach_port_t port = resources.ports[i];
+
+        // The same port can appear more than once in a message
+        bool duplicate = false;
+        for (uint32_t j = 0; j < i; j++) {
+            duplicate |= resources.ports[j] == port;
+        }
+        if (duplicate) {
+            continue;
+        }
+
+        if (!pool.backend->repair_port(port)) {
+            pool.backend->destroy_port(port);
+            pool.stats.ports_replaced++;
+            continue;
+        }
+
+        if (pool.free_port_count < PORT_POOL_SIZE) {
+            pool.free_ports[pool.free_port_count++] = port;
+        } else {
+            pool.backend->destroy_port(port);
+        }
+    }
+
+    resources.ool_buffer_count = 0;
+    resources.port_count = 0;
+}
+
+const pool_stats_t& pool_stats() {
+    return pool.stats;
+}
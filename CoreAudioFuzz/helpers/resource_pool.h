@@ -0,0 +1,99 @@
+/* 
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef RESOURCE_POOL_H
+#define RESOURCE_POOL_H
+
+#include "mach_compat.h"
+
+#include <cstddef>
+#include <cstdint>
+
+// Recycled OOL buffers and ports for message descriptors.
+//
+// Allocating fresh VM and fresh ports for every descriptor, and tearing them
+// down after every message, turns multi-message inputs into a syscall storm.
+// Instead a bounded pool of page-sized buffers and pre-created ports is handed
+// out, and after each message only what the target consumed (deallocated the
+// buffer, destroyed the port) is replaced.
+
+#define OOL_POOL_SIZE 16
+#define PORT_POOL_SIZE 32
+
+// A message carries at most 4 descriptors; each holds one buffer, and OOL
+// port arrays hold up to 4 ports each.
+#define MAX_MESSAGE_OOL_BUFFERS 4
+#define MAX_MESSAGE_PORTS 16
+
+// How the pool gets memory and ports from the system
+typedef struct {
+    const char *name;
+    void *(*allocate)(size_t size);
+    void (*deallocate)(void *buffer, size_t size);
+    // Is the buffer still mapped and ours after the target ran?
+    bool (*is_allocated)(void *buffer, size_t size);
+    mach_port_t (*create_port)(void);
+    void (*destroy_port)(mach_port_t port);
+    // Make sure we still hold receive and send rights, false if the port is beyond repair
+    bool (*repair_port)(mach_port_t port);
+} pool_backend_t;
+
+#ifdef __APPLE__
+extern const pool_backend_t mach_pool_backend;      // vm_allocate and real Mach ports
+#endif
+extern const pool_backend_t mmap_pool_backend;      // mmap and made up port names
+
+typedef struct {
+    uint64_t buffers_allocated;
+    uint64_t buffers_replaced;
+    uint64_t ports_created;
+    uint64_t ports_replaced;
+} pool_stats_t;
+
+// Everything handed out for one message, given back with pool_release()
+typedef struct {
+    void *ool_buffers[MAX_MESSAGE_OOL_BUFFERS];
+    uint32_t ool_buffer_count;
+    mach_port_t ports[MAX_MESSAGE_PORTS];
+    uint32_t port_count;
+} message_resources_t;
+
+// Select the backend. Defaults to the Mach backend on macOS and mmap elsewhere.
+// Pools are per thread; this resets the calling thread's pool.
+void pool_init(const pool_backend_t *backend);
+const pool_backend_t *pool_backend();
+
+// Give everything back to the system. The pool refills on demand.
+void pool_reset();
+
+// Drop the pooled buffers and ports that are no longer usable: buffers the
+// target deallocated since they were released, ports that lost their rights or
+// have messages queued. Returns how many were dropped; the rest stay pooled.
+size_t pool_check();
+
+// Size of every pooled buffer: MAX_OOL_DATA_SIZE rounded up to whole pages
+size_t pool_buffer_size();
+
+void *pool_acquire_ool_buffer(message_resources_t& resources);
+mach_port_t pool_acquire_port(message_resources_t& resources);
+
+// Return a message's resources once the target is done with it. Buffers
+// and ports the target consumed are replaced.
+void pool_release(message_resources_t& resources);
+
+const pool_stats_t& pool_stats();
+
+#endif // RESOURCE_POOL_H
@@ -0,0 +1,260 @@
+/* 
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "sample_minimizer.h"
+
+#include <algorithm>
+#include <map>
+
+#define WORD_SIZE 4
+
+struct minimizer_t {
+    minimize_oracle_t oracle;
+    void *arg;
+    std::map<std::vector<uint8_t>, bool> cache;
+    minimize_stats_t stats;
+    std::vector<uint8_t> best;      // smallest sample found that reproduces
+};
+
+// Put the messages back together with nothing in between the two ends. The
+// harness only starts a message with MACH_MSG_HEADER_SIZE bytes left, so pad
+// a short last message up to that.
+static void encode(const framed_sample_t& framed, std::vector<uint8_t>& data) {
+    framed_sample_t padded;
+    const message_record_t& last = framed.messages.back();
+    size_t last_size = last.front.size() + last.back.size() + (framed.messages.size() > 1);
+
+    padded.messages = framed.messages;
+    if (last_size < MACH_MSG_HEADER_SIZE) {
+        padded.unused.assign(MACH_MSG_HEADER_SIZE - last_size, 0);
+    }
+    unframe_sample(padded, data);
+}
+
+static bool test(minimizer_t& minimizer, const framed_sample_t& candidate) {
+    std::vector<uint8_t> data;
+    framed_sample_t decoded;
+
+    encode(candidate, data);
+    frame_sample(data.data(), data.size(), decoded);
+
+    bool valid = decoded.messages.size() == candidate.messages.size();
+    for (size_t i = 0; valid && i < decoded.messages.size(); i++) {
+        valid = decoded.messages[i].msg_id == candidate.messages[i].msg_id;
+    }
+    if (!valid) {
+        minimizer.stats.invalid++;
+        return false;
+    }
+
+    bool reproduces;
+    auto cached = minimizer.cache.find(data);
+    if (cached != minimizer.cache.end()) {
+        minimizer.stats.cache_hits++;
+        reproduces = cached->second;
+    } else {
+        minimizer.stats.executions++;
+        reproduces = minimizer.oracle(data, minimizer.arg);
+        minimizer.cache[data] = reproduces;
+    }
+
+    if (reproduces && data.size() <= minimizer.best.size()) {
+        minimizer.best = data;
+    }
+    return reproduces;
+}
+
+// Zeller's ddmin: a 1-minimal subset of items that passes test. items must pass.
+template <typename Test>
+static std::vector<size_t> ddmin(std::vector<size_t> items, Test test) {
+    size_t granularity = 2;
+
+    while (items.size() >= 2) {
+        size_t chunk = (items.size() + granularity - 1) / granularity;
+        bool reduced = false;
+
+        // Try each chunk on its own, then everything but each chunk
+        for (size_t start = 0; start < items.size() && !reduced; start += chunk) {
+            std::vector<size_t> subset(items.begin() + start, items.begin() + std::min(start + chunk, items.size()));
+            if (subset.size() < items.size() && test(subset)) {
+                items = subset;
+                granularity = 2;
+                reduced = true;
+            }
+        }
+        for (size_t start = 0; start < items.size() && !reduced && granularity > 2; start += chunk) {
+            std::vector<size_t> complement(items.begin(), items.begin() + start);
+            complement.insert(complement.end(), items.begin() + std::min(start + chunk, items.size()), items.end());
+            if (test(complement)) {
+                items = complement;
+                granularity = std::max(granularity - 1, (size_t)2);
+                reduced = true;
+            }
+        }
+
+        if (!reduced) {
+            if (granularity >= items.size()) {
+                break;
+            }
+            granularity = std::min(granularity * 2, items.size());
+        }
+    }
+
+    return items;
+}
+
+static framed_sample_t select_messages(const framed_sample_t& framed, const std::vector<size_t>& indices) {
+    framed_sample_t selected;
+    selected.messages.push_back(framed.messages[0]);
+    for (size_t i : indices) {
+        selected.messages.push_back(framed.messages[i]);
+    }
+    return selected;
+}
+
+static void reframe(const minimizer_t& minimizer, framed_sample_t& framed) {
+    frame_sample(minimizer.best.data(), minimizer.best.size(), framed);
+    framed.unused.clear();
+}
+
+static void minimize_messages(minimizer_t& minimizer, framed_sample_t& framed) {
+    // Whatever went wrong usually did so by the message that triggered it
+    size_t low = 1, high = framed.messages.size();
+    while (low < high) {
+        size_t middle = (low + high) / 2;
+        framed_sample_t prefix;
+        prefix.messages.assign(framed.messages.begin(), framed.messages.begin() + middle);
+        if (test(minimizer, prefix)) {
+            high = middle;
+        } else {
+            low = middle + 1;
+        }
+    }
+    framed.messages.resize(high);
+
+    if (framed.messages.size() < 2 || test(minimizer, select_messages(framed, {}))) {
+        framed.messages.resize(1);
+        return;
+    }
+
+    std::vector<size_t> indices;
+    for (size_t i = 1; i < framed.messages.size(); i++) {
+        indices.push_back(i);
+    }
+
+    indices = ddmin(indices, [&](const std::vector<size_t>& subset) {
+        return test(minimizer, select_messages(framed, subset));
+    });
+    framed = select_messages(framed, indices);
+}
+
+static void minimize_ool_data(minimizer_t& minimizer, framed_sample_t& framed) {
+    for (size_t i = 0; i < framed.messages.size(); i++) {
+        for (uint32_t j = 0; j < framed.messages[i].trace.ool_count; j++) {
+            if (framed.messages[i].trace.ool[j].data_size <= 1) {
+                continue;
+            }
+
+            framed_sample_t candidate = framed;
+            if (resize_ool_data(candidate.messages[i], j, 1) && test(minimizer, candidate)) {
+                // The data of the descriptors after it moved
+                reframe(minimizer, framed);
+            }
+        }
+    }
+}
+
+static void minimize_words(minimizer_t& minimizer, framed_sample_t& framed) {
+    // The data only ever comes from the front, and zeroing it doesn't change
+    // how much of the input a message takes
+    std::vector<std::pair<size_t, size_t>> words;
+    for (size_t i = 0; i < framed.messages.size(); i++) {
+        const std::vector<uint8_t>& front = framed.messages[i].front;
+        for (size_t offset = 0; offset < front.size(); offset += WORD_SIZE) {
+            size_t end = std::min(offset + WORD_SIZE, front.size());
+            if (std::any_of(front.begin() + offset, front.begin() + end, [](uint8_t byte) { return byte != 0; })) {
+                words.push_back({i, offset});
+            }
+        }
+    }
+
+    auto keep_only = [&](const std::vector<size_t>& kept) {
+        framed_sample_t candidate = framed;
+        std::vector<bool> keep(words.size());
+        for (size_t k : kept) {
+            keep[k] = true;
+        }
+        for (size_t k = 0; k < words.size(); k++) {
+            if (!keep[k]) {
+                std::vector<uint8_t>& front = candidate.messages[words[k].first].front;
+                std::fill(front.begin() + words[k].second, front.begin() + std::min(words[k].second + WORD_SIZE, front.size()), 0);
+            }
+        }
+        return candidate;
+    };
+
+    std::vector<size_t> kept;
+    if (words.empty() || test(minimizer, keep_only(kept))) {
+        return;
+    }
+
+    for (size_t k = 0; k < words.size(); k++) {
+        kept.push_back(k);
+    }
+    kept = ddmin(kept, [&](const std::vector<size_t>& subset) {
+        return test(minimizer, keep_only(subset));
+    });
+    framed = keep_only(kept);
+}
+
+bool minimize_sample(const std::vector<uint8_t>& sample, minimize_oracle_t oracle, void *arg,
+                     std::vector<uint8_t>& minimized, minimize_stats_t *stats) {
+    minimizer_t minimizer;
+    minimizer.oracle = oracle;
+    minimizer.arg = arg;
+    minimizer.stats = {};
+    minimizer.best = sample;
+
+    framed_sample_t framed;
+    frame_sample(sample.data(), sample.size(), framed);
+    minimizer.stats.messages_before = framed.messages.size();
+    minimizer.stats.size_before = sample.size();
+
+    minimizer.stats.executions++;
+    if (!oracle(sample, arg)) {
+        if (stats) *stats = minimizer.stats;
+        return false;
+    }
+    minimizer.cache[sample] = true;
+
+    // Anything the harness never reads goes first
+    framed.unused.clear();
+    if (!framed.messages.empty() && test(minimizer, framed)) {
+        minimize_messages(minimizer, framed);
+        reframe(minimizer, framed);
+        minimize_ool_data(minimizer, framed);
+        minimize_words(minimizer, framed);
+    }
+
+    framed_sample_t result;
+    frame_sample(minimizer.best.data(), minimizer.best.size(), result);
+    minimizer.stats.messages_after = result.messages.size();
+    minimizer.stats.size_after = minimizer.best.size();
+
+    minimized = minimizer.best;
+    if (stats) *stats = minimizer.stats;
+    return true;
+}
@@ -0,0 +1,54 @@
+/* 
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef SAMPLE_MINIMIZER_H
+#define SAMPLE_MINIMIZER_H
+
+#include "message_framing.h"
+
+// Shrinks a sample that reproduces something (a crash, usually) a message at
+// a time, using helpers/message_framing.h. Byte-level minimisers mostly
+// change the integers that frame the messages, so most of their candidates
+// send something else entirely.
+//
+//   1. the shortest prefix of messages that still reproduces (binary search)
+//   2. ddmin over the remaining messages, XSystem_Open stays first
+//   3. OOL data cut down to a byte
+//   4. ddmin over the 4 byte words of message data, zeroing the rest
+//
+// Every candidate is encoded and decoded again before the oracle sees it, and
+// skipped unless it still decodes into the intended messages. Results are
+// cached, so no candidate is run twice.
+
+// True if the sample still reproduces
+typedef bool (*minimize_oracle_t)(const std::vector<uint8_t>& sample, void *arg);
+
+typedef struct {
+    uint64_t executions;        // oracle calls
+    uint64_t cache_hits;
+    uint64_t invalid;           // candidates that decoded into other messages
+    size_t messages_before;
+    size_t messages_after;
+    size_t size_before;
+    size_t size_after;
+} minimize_stats_t;
+
+// Returns false, leaving minimized alone, if sample doesn't reproduce to
+// begin with
+bool minimize_sample(const std::vector<uint8_t>& sample, minimize_oracle_t oracle, void *arg,
+                     std::vector<uint8_t>& minimized, minimize_stats_t *stats = NULL);
+
+#endif // SAMPLE_MINIMIZER_H
@@ -16,53 +16,98 @@ limitations under the License.
 
 #include "function_hooks.h"
 
-void HALSWriteSettingHook::OnFunctionEntered() {
-    printf("HALS_SettingsManager::_WriteSetting Entered\n");
-
 #if defined(__x86_64__)
-    if (!GetRegister(RDX)) {
-        printf("NULL plist passed as argument, returning to prevent NULL CFRelease\n");
-        printf("Current $RSP: %p\n", GetRegister(RSP));
+static const Register kArgRegisters[MAX_HOOK_ARGS] = {RDI, RSI, RDX, RCX, R8, R9};
+#define RETURN_REGISTER RAX
+#elif defined(__arm64__)
+static const Register kArgRegisters[MAX_HOOK_ARGS] = {X0, X1, X2, X3, X4, X5};
+#define RETURN_REGISTER X0
+#else
+#error "Unsupported architecture"
+#endif
 
-        void *return_address;
-        
-        RemoteRead((void*)GetRegister(RSP), &return_address, sizeof(void *));
-        printf("Current return address: %p\n", GetReturnAddress());
-        printf("Current $RIP: %p\n", GetRegister(RIP));
+static size_t MaxArgs(const std::vector<HookRule> &rules) {
+  int num_args = 0;
+  for (const HookRule &rule : rules) {
+    if (rule.num_args > num_args) num_args = rule.num_args;
+  }
+  return num_args;
+}
 
-        SetRegister(RAX, 0);
-        SetRegister(RIP, GetReturnAddress());
+SpecHook::SpecHook(const std::vector<HookRule> &rules, bool log)
+  : HookBegin(rules[0].module.c_str(), rules[0].symbol.c_str(), MaxArgs(rules), CALLCONV_DEFAULT),
+    rules(rules), args_used(HookArgsUsed(rules)), log(log) {}
 
-        printf("$RIP register is now: %p\n", GetRegister(ARCH_PC));
+void SpecHook::ReturnToCaller(uint64_t return_value) {
+  SetRegister(RETURN_REGISTER, return_value);
+  SetRegister(ARCH_PC, GetReturnAddress());
+#if defined(__x86_64__)
+  SetRegister(RSP, GetRegister(RSP) + 8); // Simulate a ret instruction
+#endif
+  // On arm64 the return address is in LR, SP is as the caller left it
+}
 
-        SetRegister(RSP, GetRegister(RSP) + 8); // Simulate a ret instruction
+void SpecHook::Log(const HookOutcome &outcome, const uint64_t *args) {
+  for (size_t i = 0; i < rules.size() && i < 32; i++) {
+    if (!(outcome.matched & (1u << i))) continue;
 
-        printf("$RSP is now: %p\n", GetRegister(RSP));
-    }
-#elif defined(__arm64__)
-    // On Apple Silicon, use X2 instead of RDX, SP instead of RSP, PC instead of RIP
-    if (!GetRegister(X2)) {
-        printf("NULL plist passed as argument, returning to prevent NULL CFRelease\n");
-        printf("Current SP: %p\n", GetRegister(SP));
-
-        void *return_address;
-        RemoteRead((void*)GetRegister(SP), &return_address, sizeof(void *));
-        printf("Current return address: %p\n", GetReturnAddress());
-        printf("Current PC: %p\n", GetRegister(PC));
-
-        SetRegister(X0, 0); // X0 is usually return value on ARM64
-        SetRegister(PC, GetReturnAddress());
-        printf("PC register is now: %p\n", GetRegister(ARCH_PC));
-
-        SetRegister(SP, GetRegister(SP) + 8); // Simulate a return instruction
-        printf("SP is now: %p\n", GetRegister(SP));
+    const HookRule &rule = rules[i];
+    switch (rule.action) {
+      case HOOK_ACTION_SKIP:
+        printf("hook %s (line %d): skipped, returning 0x%llx\n", rule.symbol.c_str(), rule.line,
+               (unsigned long long)rule.return_value);
+        break;
+      case HOOK_ACTION_CLAMP:
+        if (outcome.clamped & (1u << rule.clamp_arg)) {
+          printf("hook %s (line %d): arg%d clamped to 0x%llx\n", rule.symbol.c_str(), rule.line,
+                 rule.clamp_arg, (unsigned long long)args[rule.clamp_arg]);
+        }
+        break;
+      case HOOK_ACTION_COUNT:
+        // Every power of two, the function may be hot
+        if (!(rule.hits & (rule.hits - 1))) {
+          printf("hook %s (line %d): %llu calls\n", rule.symbol.c_str(), rule.line,
+                 (unsigned long long)rule.hits);
+        }
+        break;
     }
-#else
-#error "Unsupported architecture"
-#endif
+  }
+}
+
+void SpecHook::OnFunctionEntered() {
+  uint64_t args[MAX_HOOK_ARGS] = {};
+  for (int i = 0; i < MAX_HOOK_ARGS; i++) {
+    if (args_used & (1u << i)) args[i] = GetRegister(kArgRegisters[i]);
+  }
+
+  HookOutcome outcome = EvaluateHookRules(rules, args);
+  if (!outcome.matched) return;
+
+  for (int i = 0; i < MAX_HOOK_ARGS; i++) {
+    if (outcome.clamped & (1u << i)) SetRegister(kArgRegisters[i], args[i]);
+  }
+  if (log) Log(outcome, args);
+  if (outcome.skip) ReturnToCaller(outcome.return_value);
 }
 
-FunctionHookInst::FunctionHookInst() {
-    printf("Registering function hooks!\n");
-    RegisterHook(new HALSWriteSettingHook());
+FunctionHookInst::FunctionHookInst(const char *spec_path, bool log) {
+  std::vector<HookRule> rules;
+  std::string error;
+
+  bool loaded = spec_path ? LoadHookSpec(spec_path, &rules, &error)
+                          : ParseHookSpec(kDefaultHookSpec, &rules, &error);
+  if (!loaded) {
+    FATAL("Error loading hook spec: %s", error.c_str());
+  }
+
+  std::vector<std::vector<HookRule>> hooks = GroupHookRules(rules);
+  for (const std::vector<HookRule> &hook_rules : hooks) {
+    if (log) {
+      for (const HookRule &rule : hook_rules) {
+        printf("Hooking %s\n", HookRuleToString(rule).c_str());
+      }
+    }
+    RegisterHook(new SpecHook(hook_rules, log));
+  }
+  printf("Registered %zu function hooks from %s\n", hooks.size(), spec_path ? spec_path : "the built-in spec");
 }
@@ -19,17 +19,27 @@ limitations under the License.
 
 #include "TinyInst/hook.h"
 #include "litecov.h"
+#include "hook_spec.h"
 
-class HALSWriteSettingHook : public HookBegin {
+// The rules of one symbol from the hook spec
+class SpecHook : public HookBegin {
 public:
-  HALSWriteSettingHook() : HookBegin("CoreAudio", "__ZN11HALS_System13_WriteSettingEP11HALS_ClientPK10__CFStringPKv", 3, CALLCONV_DEFAULT) {}
+  SpecHook(const std::vector<HookRule> &rules, bool log);
 protected:
   void OnFunctionEntered() override;
+private:
+  void ReturnToCaller(uint64_t return_value);
+  void Log(const HookOutcome &outcome, const uint64_t *args);
+
+  std::vector<HookRule> rules;
+  uint32_t args_used;
+  bool log;
 };
 
 class FunctionHookInst : public LiteCov {
 public:
-  FunctionHookInst();
+  // The built-in spec if spec_path is NULL
+  FunctionHookInst(const char *spec_path, bool log);
 };
 
 #endif
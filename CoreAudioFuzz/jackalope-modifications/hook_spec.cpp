@@ -0,0 +1,308 @@
+/* 
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "hook_spec.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <fstream>
+#include <sstream>
+
+// HALS_System::_WriteSetting CFRelease's its arg2 without a NULL check
+const char *kDefaultHookSpec =
+  "CoreAudio __ZN11HALS_System13_WriteSettingEP11HALS_ClientPK10__CFStringPKv 3 if arg2 == 0 skip 0\n";
+
+static const char *kOpNames[] = {"==", "!=", "<", "<=", ">", ">=", "&"};
+
+static bool ParseValue(const std::string &token, uint64_t *value) {
+  if (token.empty()) return false;
+
+  const char *start = token.c_str();
+  bool negative = *start == '-';
+  if (negative) start++;
+  if (*start < '0' || *start > '9') return false;
+
+  char *end;
+  errno = 0;
+  uint64_t parsed = strtoull(start, &end, 0);
+  if (*end || errno) return false;
+
+  *value = negative ? 0 - parsed : parsed;
+  return true;
+}
+
+static bool ParseArg(const std::string &token, int *arg) {
+  if (token.size() != 4 || token.compare(0, 3, "arg") || token[3] < '0' || token[3] >= '0' + MAX_HOOK_ARGS) {
+    return false;
+  }
+  *arg = token[3] - '0';
+  return true;
+}
+
+static bool ParseOp(const std::string &token, HookOp *op) {
+  for (size_t i = 0; i < sizeof(kOpNames) / sizeof(kOpNames[0]); i++) {
+    if (token == kOpNames[i]) {
+      *op = (HookOp)i;
+      return true;
+    }
+  }
+  return false;
+}
+
+// Everything in line after the module and symbol
+static bool ParseRule(const std::vector<std::string> &tokens, HookRule *rule, std::string *what) {
+  size_t pos = 2;
+  auto next = [&]() -> std::string {
+    return pos < tokens.size() ? tokens[pos++] : std::string();
+  };
+
+  uint64_t num_args;
+  if (!ParseValue(next(), &num_args) || num_args > MAX_HOOK_ARGS) {
+    *what = "expected the number of arguments (0-" + std::to_string(MAX_HOOK_ARGS) + ")";
+    return false;
+  }
+  rule->num_args = (int)num_args;
+
+  std::string token = next();
+  if (token == "if") {
+    do {
+      HookCondition condition;
+      if (!ParseArg(next(), &condition.arg)) {
+        *what = "expected arg0-arg" + std::to_string(MAX_HOOK_ARGS - 1) + " in condition";
+        return false;
+      }
+      if (!ParseOp(next(), &condition.op)) {
+        *what = "expected one of == != < <= > >= & in condition";
+        return false;
+      }
+      if (!ParseValue(next(), &condition.value)) {
+        *what = "expected a value in condition";
+        return false;
+      }
+      rule->conditions.push_back(condition);
+      token = next();
+    } while (token == "and");
+  }
+
+  if (token == "skip") {
+    rule->action = HOOK_ACTION_SKIP;
+    if (pos < tokens.size() && !ParseValue(next(), &rule->return_value)) {
+      *what = "expected a return value after skip";
+      return false;
+    }
+  } else if (token == "clamp") {
+    rule->action = HOOK_ACTION_CLAMP;
+    if (!ParseArg(next(), &rule->clamp_arg) ||
+        !ParseValue(next(), &rule->clamp_min) ||
+        !ParseValue(next(), &rule->clamp_max)) {
+      *what = "expected clamp arg<N> <min> <max>";
+      return false;
+    }
+    if (rule->clamp_min > rule->clamp_max) {
+      *what = "clamp minimum is above the maximum";
+      return false;
+    }
+  } else if (token == "count") {
+    rule->action = HOOK_ACTION_COUNT;
+  } else {
+    *what = token.empty() ? "missing action" : "unknown action '" + token + "'";
+    return false;
+  }
+
+  if (pos < tokens.size()) {
+    *what = "unexpected '" + tokens[pos] + "' after action";
+    return false;
+  }
+
+  // Hooks only ever see the arguments they were declared with
+  for (const HookCondition &condition : rule->conditions) {
+    if (condition.arg >= rule->num_args) {
+      *what = "condition on arg" + std::to_string(condition.arg) + " of a " +
+              std::to_string(rule->num_args) + " argument function";
+      return false;
+    }
+  }
+  if (rule->action == HOOK_ACTION_CLAMP && rule->clamp_arg >= rule->num_args) {
+    *what = "clamp of arg" + std::to_string(rule->clamp_arg) + " of a " +
+            std::to_string(rule->num_args) + " argument function";
+    return false;
+  }
+  return true;
+}
+
+bool ParseHookSpec(const std::string &text, std::vector<HookRule> *rules, std::string *error) {
+  std::istringstream lines(text);
+  std::string line;
+  int line_number = 0;
+
+  while (std::getline(lines, line)) {
+    line_number++;
+    size_t comment = line.find('#');
+    if (comment != std::string::npos) line.resize(comment);
+
+    std::istringstream words(line);
+    std::vector<std::string> tokens;
+    std::string token;
+    while (words >> token) tokens.push_back(token);
+    if (tokens.empty()) continue;
+
+    HookRule rule = {};
+    rule.line = line_number;
+    std::string what = "expected <module> <symbol> <num_args>";
+    if (tokens.size() >= 3) {
+      rule.module = tokens[0];
+      rule.symbol = tokens[1];
+    }
+    if (tokens.size() < 3 || !ParseRule(tokens, &rule, &what)) {
+      *error = "line " + std::to_string(line_number) + ": " + what;
+      return false;
+    }
+    rules->push_back(rule);
+  }
+
+  return true;
+}
+
+bool LoadHookSpec(const char *path, std::vector<HookRule> *rules, std::string *error) {
+  std::ifstream file(path);
+  if (!file) {
+    *error = std::string(path) + ": " + strerror(errno);
+    return false;
+  }
+
+  std::stringstream text;
+  text << file.rdbuf();
+  if (!ParseHookSpec(text.str(), rules, error)) {
+    *error = std::string(path) + ": " + *error;
+    return false;
+  }
+  return true;
+}
+
+uint32_t HookArgsUsed(const std::vector<HookRule> &rules) {
+  uint32_t used = 0;
+  for (const HookRule &rule : rules) {
+    for (const HookCondition &condition : rule.conditions) {
+      used |= 1u << condition.arg;
+    }
+    if (rule.action == HOOK_ACTION_CLAMP) {
+      used |= 1u << rule.clamp_arg;
+    }
+  }
+  return used;
+}
+
+static bool ConditionHolds(const HookCondition &condition, uint64_t arg) {
+  switch (condition.op) {
+    case HOOK_OP_EQ: return arg == condition.value;
+    case HOOK_OP_NE: return arg != condition.value;
+    case HOOK_OP_LT: return arg < condition.value;
+    case HOOK_OP_LE: return arg <= condition.value;
+    case HOOK_OP_GT: return arg > condition.value;
+    case HOOK_OP_GE: return arg >= condition.value;
+    case HOOK_OP_MASK: return (arg & condition.value) != 0;
+  }
+  return false;
+}
+
+HookOutcome EvaluateHookRules(std::vector<HookRule> &rules, uint64_t *args) {
+  HookOutcome outcome = {};
+
+  for (size_t i = 0; i < rules.size(); i++) {
+    HookRule &rule = rules[i];
+
+    bool holds = true;
+    for (const HookCondition &condition : rule.conditions) {
+      if (!ConditionHolds(condition, args[condition.arg])) {
+        holds = false;
+        break;
+      }
+    }
+    if (!holds) continue;
+
+    rule.hits++;
+    if (i < 32) outcome.matched |= 1u << i;
+
+    if (rule.action == HOOK_ACTION_SKIP) {
+      outcome.skip = true;
+      outcome.return_value = rule.return_value;
+      break;
+    } else if (rule.action == HOOK_ACTION_CLAMP) {
+      uint64_t &arg = args[rule.clamp_arg];
+      uint64_t clamped = arg < rule.clamp_min ? rule.clamp_min : arg > rule.clamp_max ? rule.clamp_max : arg;
+      if (clamped != arg) {
+        arg = clamped;
+        outcome.clamped |= 1u << rule.clamp_arg;
+      }
+    }
+  }
+
+  return outcome;
+}
+
+std::vector<std::vector<HookRule>> GroupHookRules(const std::vector<HookRule> &rules) {
+  std::vector<std::vector<HookRule>> groups;
+
+  for (const HookRule &rule : rules) {
+    std::vector<HookRule> *group = NULL;
+    for (std::vector<HookRule> &existing : groups) {
+      if (existing[0].module == rule.module && existing[0].symbol == rule.symbol) {
+        group = &existing;
+        break;
+      }
+    }
+    if (!group) {
+      groups.emplace_back();
+      group = &groups.back();
+    }
+    group->push_back(rule);
+  }
+
+  return groups;
+}
+
+static std::string ValueToString(uint64_t value) {
+  char buffer[32];
+  snprintf(buffer, sizeof(buffer), value < 0x10000 ? "%llu" : "0x%llx", (unsigned long long)value);
+  return buffer;
+}
+
+std::string HookRuleToString(const HookRule &rule) {
+  std::string text = rule.module + " " + rule.symbol + " " + std::to_string(rule.num_args);
+
+  for (size_t i = 0; i < rule.conditions.size(); i++) {
+    const HookCondition &condition = rule.conditions[i];
+    text += i ? " and arg" : " if arg";
+    text += std::to_string(condition.arg) + " " + kOpNames[condition.op] + " " + ValueToString(condition.value);
+  }
+
+  switch (rule.action) {
+    case HOOK_ACTION_SKIP:
+      text += " skip " + ValueToString(rule.return_value);
+      break;
+    case HOOK_ACTION_CLAMP:
+      text += " clamp arg" + std::to_string(rule.clamp_arg) + " " +
+              ValueToString(rule.clamp_min) + " " + ValueToString(rule.clamp_max);
+      break;
+    case HOOK_ACTION_COUNT:
+      text += " count";
+      break;
+  }
+  return text;
+}
@@ -0,0 +1,108 @@
+/* 
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef HOOKSPEC_H
+#define HOOKSPEC_H
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+// Function hooks as a text file rather than C++. One rule per line:
+//
+//   <module> <symbol> <num_args> [if <cond> [and <cond>]...] <action>
+//
+//   cond:    arg<N> <op> <value>    op is == != < <= > >= or & (any bit set)
+//   action:  skip [<return value>]  return straight to the caller
+//            clamp arg<N> <min> <max>
+//            count                  only count the calls that match
+//
+// Values are unsigned 64 bit, decimal or 0x hex; a leading - wraps around.
+// Everything after # is a comment. The rules for a symbol run in file order:
+// clamps change the arguments the later rules see, the first skip that
+// matches ends it. This file is TinyInst-free so it builds on Linux
+// (tools/check_hook_spec.cc, tools/check_hook_rules.cc); function_hooks.cpp
+// turns the rules into hooks.
+
+// Arguments the hooks can read, the ones passed in registers on x86_64
+#define MAX_HOOK_ARGS 6
+
+enum HookOp {
+  HOOK_OP_EQ,
+  HOOK_OP_NE,
+  HOOK_OP_LT,
+  HOOK_OP_LE,
+  HOOK_OP_GT,
+  HOOK_OP_GE,
+  HOOK_OP_MASK,
+};
+
+enum HookAction {
+  HOOK_ACTION_SKIP,
+  HOOK_ACTION_CLAMP,
+  HOOK_ACTION_COUNT,
+};
+
+struct HookCondition {
+  int arg;
+  HookOp op;
+  uint64_t value;
+};
+
+struct HookRule {
+  std::string module;
+  std::string symbol;
+  int num_args;
+  std::vector<HookCondition> conditions;
+  HookAction action;
+  uint64_t return_value;  // skip
+  int clamp_arg;          // clamp
+  uint64_t clamp_min;
+  uint64_t clamp_max;
+  int line;
+  uint64_t hits;          // times the conditions held
+};
+
+// What the rules for one call came to
+struct HookOutcome {
+  bool skip;
+  uint64_t return_value;
+  uint32_t clamped;       // bit N set if arg N changed
+  uint32_t matched;       // bit N set if rule N matched
+};
+
+// The built-in spec, used without -hook_spec. Same as hooks.spec.
+extern const char *kDefaultHookSpec;
+
+// Appends the rules in text to rules. On a malformed line, returns false with
+// error set to what and where.
+bool ParseHookSpec(const std::string &text, std::vector<HookRule> *rules, std::string *error);
+bool LoadHookSpec(const char *path, std::vector<HookRule> *rules, std::string *error);
+
+// Bit N set if the rules read or write arg N
+uint32_t HookArgsUsed(const std::vector<HookRule> &rules);
+
+// Runs the rules of one symbol over its arguments, clamping args in place.
+// At most 32 rules per symbol are reported in matched.
+HookOutcome EvaluateHookRules(std::vector<HookRule> &rules, uint64_t *args);
+
+// Rules that share a module and symbol, in file order
+std::vector<std::vector<HookRule>> GroupHookRules(const std::vector<HookRule> &rules);
+
+std::string HookRuleToString(const HookRule &rule);
+
+#endif
@@ -0,0 +1,10 @@
+# Function hooks for -hook_functions, loaded with -hook_spec. The format is
+# described in hook_spec.h; check a spec with ../check_hook_spec (make host).
+#
+#   <module> <symbol> <num_args> [if <cond> [and <cond>]...] <action>
+#
+# arg0-arg5 are RDI, RSI, RDX, RCX, R8, R9 on x86_64 and X0-X5 on arm64, so
+# arg0 of a member function is this.
+
+# HALS_System::_WriteSetting CFRelease's its arg2 without a NULL check
+CoreAudio __ZN11HALS_System13_WriteSettingEP11HALS_ClientPK10__CFStringPKv 3 if arg2 == 0 skip 0
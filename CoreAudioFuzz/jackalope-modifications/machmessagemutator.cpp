@@ -0,0 +1,195 @@
+/* 
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "machmessagemutator.h"
+
+// Splices take at most this many messages from the other sample
+#define MAX_SPLICE_MESSAGES 8
+
+bool MachMessageMutator::Mutate(Sample *inout_sample, PRNG *prng, std::vector<Sample *> &all_samples) {
+  framed_sample_t framed;
+  frame_sample((const uint8_t *)inout_sample->bytes, inout_sample->size, framed);
+  if (framed.messages.empty()) return false;
+
+  bool mutated = false;
+  switch (prng->Rand(0, 9)) {
+  case 0:
+    mutated = InsertMessage(framed, prng, all_samples);
+    break;
+  case 1:
+    mutated = DeleteMessage(framed, prng);
+    break;
+  case 2:
+    mutated = MoveMessage(framed, prng);
+    break;
+  case 3:
+    mutated = SpliceMessages(framed, prng, all_samples);
+    break;
+  case 4:
+    mutated = MutateMessageId(framed, prng);
+    break;
+  case 5:
+  case 6:
+    mutated = MutateSelector(framed, prng);
+    break;
+  case 7:
+    mutated = ResizeOOLData(framed, prng);
+    break;
+  default:
+    mutated = MutateMessageBytes(framed, prng, all_samples);
+    break;
+  }
+  if (!mutated) return false;
+
+  std::vector<uint8_t> data;
+  unframe_sample(framed, data);
+
+  // The harness ignores anything past MAX_SAMPLE_SIZE
+  if (data.size() > MAX_SAMPLE_SIZE) return false;
+
+  inout_sample->Init((const char *)data.data(), data.size());
+  return true;
+}
+
+bool MachMessageMutator::FrameRandomSample(framed_sample_t &framed, PRNG *prng, std::vector<Sample *> &all_samples) {
+  if (all_samples.empty()) return false;
+
+  Sample *sample = all_samples[prng->Rand(0, (int)all_samples.size() - 1)];
+  frame_sample((const uint8_t *)sample->bytes, sample->size, framed);
+  return !framed.messages.empty();
+}
+
+// Messages other than the first (XSystem_Open, which has to stay first) can
+// go anywhere. Those that ran out of input are only complete at the end.
+
+bool MachMessageMutator::InsertMessage(framed_sample_t &framed, PRNG *prng, std::vector<Sample *> &all_samples) {
+  framed_sample_t other;
+  if (!FrameRandomSample(other, prng, all_samples)) return false;
+
+  const message_record_t &record = other.messages[prng->Rand(0, (int)other.messages.size() - 1)];
+  if (!record.complete) return false;
+
+  framed.messages.insert(framed.messages.begin() + prng->Rand(1, (int)framed.messages.size()), record);
+  return true;
+}
+
+bool MachMessageMutator::DeleteMessage(framed_sample_t &framed, PRNG *prng) {
+  if (framed.messages.size() < 2) return false;
+
+  framed.messages.erase(framed.messages.begin() + prng->Rand(1, (int)framed.messages.size() - 1));
+  return true;
+}
+
+bool MachMessageMutator::MoveMessage(framed_sample_t &framed, PRNG *prng) {
+  if (framed.messages.size() < 3) return false;
+
+  size_t from = prng->Rand(1, (int)framed.messages.size() - 1);
+  size_t to = prng->Rand(1, (int)framed.messages.size() - 2);
+  if (!framed.messages[from].complete) return false;
+
+  message_record_t record = framed.messages[from];
+  framed.messages.erase(framed.messages.begin() + from);
+  framed.messages.insert(framed.messages.begin() + to + (to >= from), record);
+  return true;
+}
+
+bool MachMessageMutator::SpliceMessages(framed_sample_t &framed, PRNG *prng, std::vector<Sample *> &all_samples) {
+  framed_sample_t other;
+  if (!FrameRandomSample(other, prng, all_samples)) return false;
+
+  // Our messages up to a point, followed by a run of theirs
+  size_t keep = prng->Rand(1, (int)framed.messages.size());
+  size_t start = prng->Rand(0, (int)other.messages.size() - 1);
+  size_t count = prng->Rand(1, (int)std::min(other.messages.size() - start, (size_t)MAX_SPLICE_MESSAGES));
+
+  framed.messages.resize(keep);
+  framed.messages.insert(framed.messages.end(), other.messages.begin() + start,
+                         other.messages.begin() + start + count);
+  return true;
+}
+
+bool MachMessageMutator::MutateMessageId(framed_sample_t &framed, PRNG *prng) {
+  if (framed.messages.size() < 2) return false;
+
+  message_record_t &record = framed.messages[prng->Rand(1, (int)framed.messages.size() - 1)];
+  set_message_id(record, prng->Rand(kFirstMessageId, kLastMessageId));
+  return true;
+}
+
+bool MachMessageMutator::MutateSelector(framed_sample_t &framed, PRNG *prng) {
+  std::vector<size_t> candidates;
+  for (size_t i = 0; i < framed.messages.size(); i++) {
+    uint32_t selector_bytes = framed.messages[i].trace.selector_bytes;
+    if (selector_bytes == 8 || selector_bytes == 11) candidates.push_back(i);
+  }
+  if (candidates.empty()) return false;
+
+  message_record_t &record = framed.messages[candidates[prng->Rand(0, (int)candidates.size() - 1)]];
+  return set_selector_choice(record,
+                             prng->Rand(0, (int)kValidSelectors.size() - 1),
+                             prng->Rand(0, (int)kValidScopes.size() - 1),
+                             prng->Rand(0, (int)kValidElements.size() - 1));
+}
+
+bool MachMessageMutator::ResizeOOLData(framed_sample_t &framed, PRNG *prng) {
+  std::vector<size_t> candidates;
+  for (size_t i = 0; i < framed.messages.size(); i++) {
+    if (framed.messages[i].trace.ool_count > 0) candidates.push_back(i);
+  }
+  if (candidates.empty()) return false;
+
+  message_record_t &record = framed.messages[candidates[prng->Rand(0, (int)candidates.size() - 1)]];
+  uint32_t index = prng->Rand(0, record.trace.ool_count - 1);
+  uint32_t current = record.trace.ool[index].data_size;
+
+  uint32_t size;
+  switch (prng->Rand(0, 3)) {
+  case 0:
+    size = prng->Rand(1, 16);
+    break;
+  case 1:
+    size = std::max(current / 2, 1u);
+    break;
+  case 2:
+    size = std::min(current * 2, (uint32_t)MAX_OOL_DATA_SIZE);
+    break;
+  default:
+    size = prng->Rand(1, MAX_OOL_DATA_SIZE);
+    break;
+  }
+
+  return resize_ool_data(record, index, size);
+}
+
+bool MachMessageMutator::MutateMessageBytes(framed_sample_t &framed, PRNG *prng, std::vector<Sample *> &all_samples) {
+  message_record_t &record = framed.messages[prng->Rand(0, (int)framed.messages.size() - 1)];
+
+  // Mostly the data. The integers are the message's flags, sizes and
+  // descriptor fields, where a change can make the message take a different
+  // number of bytes.
+  std::vector<uint8_t> &part = prng->Rand(0, 3) ? record.front : record.back;
+  if (part.empty()) return false;
+
+  Sample sample;
+  sample.Init((const char *)part.data(), part.size());
+  if (!byte_mutator->Mutate(&sample, prng, all_samples)) return false;
+
+  // Keep the size so the other messages stay where they are
+  size_t size = part.size();
+  part.assign((uint8_t *)sample.bytes, (uint8_t *)sample.bytes + std::min(sample.size, size));
+  part.resize(size);
+  return true;
+}
@@ -0,0 +1,48 @@
+/* 
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include "mutator.h"
+#include "message_framing.h"
+
+// Mutates harness inputs a Mach message at a time (see
+// helpers/message_framing.h): inserts, deletes, moves and splices whole
+// messages, changes message IDs, picks valid selectors, scopes and elements,
+// resizes OOL data, and runs byte_mutator on the bytes of a single message.
+// Byte-level mutators on the whole sample mostly hit the integers that frame
+// the messages, which changes what gets sent rather than what it contains.
+class MachMessageMutator : public Mutator {
+public:
+  MachMessageMutator(Mutator *byte_mutator) : byte_mutator(byte_mutator) { }
+  ~MachMessageMutator() { delete byte_mutator; }
+
+  bool Mutate(Sample *inout_sample, PRNG *prng, std::vector<Sample *> &all_samples) override;
+
+protected:
+  bool InsertMessage(framed_sample_t &framed, PRNG *prng, std::vector<Sample *> &all_samples);
+  bool DeleteMessage(framed_sample_t &framed, PRNG *prng);
+  bool MoveMessage(framed_sample_t &framed, PRNG *prng);
+  bool SpliceMessages(framed_sample_t &framed, PRNG *prng, std::vector<Sample *> &all_samples);
+  bool MutateMessageId(framed_sample_t &framed, PRNG *prng);
+  bool MutateSelector(framed_sample_t &framed, PRNG *prng);
+  bool ResizeOOLData(framed_sample_t &framed, PRNG *prng);
+  bool MutateMessageBytes(framed_sample_t &framed, PRNG *prng, std::vector<Sample *> &all_samples);
+
+  bool FrameRandomSample(framed_sample_t &framed, PRNG *prng, std::vector<Sample *> &all_samples);
+
+  Mutator *byte_mutator;
+};
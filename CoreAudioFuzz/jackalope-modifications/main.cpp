@@ -17,6 +17,7 @@ limitations under the License.
 #include "common.h"
 #include "fuzzer.h"
 #include "mutator.h"
+#include "machmessagemutator.h"
 #include "tinyinsthookinstrumentation.h"
 
 
@@ -68,6 +69,25 @@ Mutator * BinaryFuzzer::CreateMutator(int argc, char **argv, ThreadContext *tc)
   }
   pselect->AddMutator(iv_mutator, 0.1);
 
+  // mutate whole Mach messages and fields within them,
+  // see machmessagemutator.h
+  if (GetBinaryOption("-mach_message_mutations", argc, argv, true)) {
+    // byte mutations confined to a single message, so they
+    // must not change its size
+    PSelectMutator *message_pselect = new PSelectMutator();
+    message_pselect->AddMutator(new ByteFlipMutator(), 0.8);
+    message_pselect->AddMutator(new ArithmeticMutator(), 0.2);
+    message_pselect->AddMutator(new BlockFlipMutator(2, 16), 0.1);
+    if(dictionary) {
+      InterestingValueMutator *message_iv_mutator = new InterestingValueMutator(false);
+      message_iv_mutator->AddDictionary(dictionary);
+      message_pselect->AddMutator(message_iv_mutator, 0.1);
+    } else {
+      message_pselect->AddMutator(new InterestingValueMutator(true), 0.1);
+    }
+    pselect->AddMutator(new MachMessageMutator(message_pselect), 1.0);
+  }
+
   // SpliceMutator is not compatible with -keep_samples_in_memory=0
   // as it requires other samples in memory besides the one being
   // fuzzed.
@@ -19,7 +19,8 @@ limitations under the License.
 #include "function_hooks.h"
 
 void TinyInstHookInstrumentation::Init(int argc, char **argv) {
-  instrumentation = new FunctionHookInst();
+  instrumentation = new FunctionHookInst(GetOption("-hook_spec", argc, argv),
+                                         GetBinaryOption("-hook_log", argc, argv, false));
   instrumentation->Init(argc, argv);
 
   persist = GetBinaryOption("-persist", argc, argv, false);
@@ -0,0 +1,156 @@
+/*
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+// Measures how fast LLVMFuzzerTestOneInput turns inputs into messages when
+// the processing function is the mock, i.e. the harness's own overhead.
+//
+//   ./bench_messages [-n inputs] [-s input_size] [-t seconds] [-g] [-O] [sample ...]
+//
+// Without samples, -n random inputs of -s bytes are generated. With -g only
+// generate_message() is timed, cycling through every message ID. -O leaves
+// object IDs as the fuzz input has them, to compare against object tracking.
+
+#include "harness.h"
+#include "message_generator.h"
+#include "mock_processing.h"
+#include "object_tracker.h"
+#include "tool_util.h"
+
+#include <getopt.h>
+
+static void print_pool_stats() {
+    const pool_stats_t& stats = pool_stats();
+    printf("pool (%s):   %llu buffers allocated, %llu replaced; %llu ports created, %llu replaced\n",
+           pool_backend()->name, (unsigned long long)stats.buffers_allocated, (unsigned long long)stats.buffers_replaced,
+           (unsigned long long)stats.ports_created, (unsigned long long)stats.ports_replaced);
+}
+
+static void print_object_stats() {
+    const object_tracker_stats_t& stats = object_tracker_stats();
+    printf("object IDs:    %llu kept, %llu probed, %llu tracked (%s)\n", (unsigned long long)stats.kept,
+           (unsigned long long)stats.probed, (unsigned long long)stats.tracked, object_tracking ? "on" : "off");
+    printf("objects:       %zu tracked; %llu created, %llu confirmed, %llu removed\n", object_tracker_count(),
+           (unsigned long long)stats.created, (unsigned long long)stats.confirmed, (unsigned long long)stats.removed);
+    printf("past lookup:   %llu messages (%.1f%%)\n", (unsigned long long)mock_object_message_count,
+           mock_message_count ? 100.0 * mock_object_message_count / mock_message_count : 0.0);
+}
+
+int main(int argc, char *argv[]) {
+    size_t input_count = 1000;
+    size_t input_size = 2000;
+    double duration = 5.0;
+    bool generate_only = false;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "n:s:t:gOv")) != -1) {
+        switch (opt) {
+            case 'n':
+                input_count = strtoul(optarg, NULL, 0);
+                break;
+            case 's':
+                input_size = strtoul(optarg, NULL, 0);
+                break;
+            case 't':
+                duration = strtod(optarg, NULL);
+                break;
+            case 'g':
+                generate_only = true;
+                break;
+            case 'O':
+                object_tracking = false;
+                break;
+            case 'v':
+                verbose = 1;
+                break;
+            default:
+                fprintf(stderr, "Usage: %s [-n inputs] [-s input_size] [-t seconds] [-g] [-O] [-v] [sample ...]\n", argv[0]);
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    std::vector<std::vector<uint8_t>> inputs;
+    if (optind < argc) {
+        for (int i = optind; i < argc; i++) {
+            std::vector<uint8_t> sample;
+            if (read_sample(argv[i], sample)) {
+                inputs.push_back(sample);
+            }
+        }
+    } else {
+        uint64_t state = 0x9e3779b97f4a7c15ULL;
+        for (size_t i = 0; i < input_count; i++) {
+            std::vector<uint8_t> input(input_size);
+            for (size_t j = 0; j < input_size; j++) {
+                state ^= state << 13;
+                state ^= state >> 7;
+                state ^= state << 17;
+                input[j] = (uint8_t)state;
+            }
+            inputs.push_back(input);
+        }
+    }
+
+    if (inputs.empty()) {
+        fprintf(stderr, "No inputs\n");
+        return 1;
+    }
+
+    if (generate_only) {
+        message_buffer_t& mach_msg = thread_message_buffer();
+        message_resources_t resources = {};
+        uint64_t messages = 0;
+        uint64_t bytes = 0;
+        double start = now_seconds();
+        double elapsed = 0;
+        while (elapsed < duration) {
+            for (const auto& input : inputs) {
+                FuzzedDataProvider fuzz_data(input.data(), input.size());
+                generate_message(kFirstMessageId + messages % kMessageIdCount, fuzz_data, mach_msg, resources);
+                pool_release(resources);
+                bytes += mach_msg.size;
+                messages++;
+            }
+            elapsed = now_seconds() - start;
+        }
+
+        printf("generated:     %llu messages in %.2fs (%.0f/s, %.1f MB/s)\n", (unsigned long long)messages, elapsed,
+               messages / elapsed, bytes / elapsed / 1e6);
+        printf("per message:   %.0f ns\n", elapsed * 1e9 / messages);
+        print_pool_stats();
+        return 0;
+    }
+
+    uint64_t executions = 0;
+    double start = now_seconds();
+    double elapsed = 0;
+    while (elapsed < duration) {
+        for (const auto& input : inputs) {
+            LLVMFuzzerTestOneInput(input.data(), input.size());
+        }
+        executions += inputs.size();
+        elapsed = now_seconds() - start;
+    }
+
+    printf("inputs:        %zu\n", inputs.size());
+    printf("executions:    %llu in %.2fs (%.0f/s)\n", (unsigned long long)executions, elapsed, executions / elapsed);
+    printf("messages:      %llu (%.0f/s, %.1f per input)\n", (unsigned long long)mock_message_count,
+           mock_message_count / elapsed, (double)mock_message_count / executions);
+    printf("per message:   %.0f ns\n", elapsed * 1e9 / mock_message_count);
+    print_pool_stats();
+    print_object_stats();
+
+    return 0;
+}
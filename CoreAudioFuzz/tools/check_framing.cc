@@ -0,0 +1,164 @@
+/* 
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+// Checks helpers/message_framing against the harness:
+// - every input survives frame_sample() and unframe_sample() unchanged,
+// - frame_sample() finds as many messages as LLVMFuzzerTestOneInput sends,
+// - selector and OOL size edits come out of the generator as intended.
+//
+//   ./check_framing [-n inputs] [-s input_size] [sample ...]
+//
+// Exits with 1 if anything doesn't match.
+
+#include "harness.h"
+#include "message_framing.h"
+#include "mock_processing.h"
+#include "tool_util.h"
+
+#include <getopt.h>
+
+static uint64_t state = 0x9e3779b97f4a7c15ULL;
+
+static uint32_t next_random() {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return (uint32_t)state;
+}
+
+// The selector the generator put in the index'th message of input
+static uint32_t generated_selector(const std::vector<uint8_t>& input, size_t index) {
+    FuzzedDataProvider fuzz_data(input.data(), input.size());
+    message_buffer_t& mach_msg = thread_message_buffer();
+    message_resources_t resources = {};
+    uint32_t selector = 0;
+
+    for (size_t i = 0; i <= index && fuzz_data.remaining_bytes() >= MACH_MSG_HEADER_SIZE; i++) {
+        uint32_t msg_id = consume_message_id(fuzz_data, i == 0);
+        generate_message(msg_id, fuzz_data, mach_msg, resources);
+        pool_release(resources);
+    }
+
+    memcpy(&selector, mach_msg.data + mach_msg.size - MACH_MSG_TRAILER_SIZE - 16, sizeof(uint32_t));
+    return selector;
+}
+
+int main(int argc, char *argv[]) {
+    size_t input_count = 10000;
+    size_t input_size = 2000;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "n:s:")) != -1) {
+        switch (opt) {
+            case 'n':
+                input_count = strtoul(optarg, NULL, 0);
+                break;
+            case 's':
+                input_size = strtoul(optarg, NULL, 0);
+                break;
+            default:
+                fprintf(stderr, "Usage: %s [-n inputs] [-s input_size] [sample ...]\n", argv[0]);
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    std::vector<std::vector<uint8_t>> inputs;
+    if (optind < argc) {
+        for (int i = optind; i < argc; i++) {
+            std::vector<uint8_t> sample;
+            if (read_sample(argv[i], sample)) {
+                inputs.push_back(sample);
+            }
+        }
+    } else {
+        for (size_t i = 0; i < input_count; i++) {
+            // Vary the size so inputs end in every part of a message
+            std::vector<uint8_t> input(next_random() % (input_size + 1));
+            for (uint8_t& byte : input) {
+                byte = (uint8_t)next_random();
+            }
+            inputs.push_back(input);
+        }
+    }
+
+    uint64_t messages = 0;
+    uint64_t round_trip_failures = 0;
+    uint64_t count_failures = 0;
+    uint64_t selector_edits = 0, selector_failures = 0;
+    uint64_t ool_edits = 0, ool_failures = 0;
+
+    for (const auto& input : inputs) {
+        framed_sample_t framed;
+        std::vector<uint8_t> output;
+
+        frame_sample(input.data(), input.size(), framed);
+        unframe_sample(framed, output);
+        messages += framed.messages.size();
+
+        if (output != input) {
+            round_trip_failures++;
+        }
+
+        uint64_t sent = mock_message_count;
+        LLVMFuzzerTestOneInput(input.data(), input.size());
+        if (mock_message_count - sent != framed.messages.size()) {
+            count_failures++;
+        }
+
+        for (size_t i = 1; i < framed.messages.size(); i++) {
+            const message_record_t& record = framed.messages[i];
+            if (!record.complete) {
+                continue;
+            }
+
+            framed_sample_t edited = framed;
+            uint32_t selector = next_random() % kValidSelectors.size();
+            if (set_selector_choice(edited.messages[i], selector, next_random() % kValidScopes.size(),
+                                    next_random() % kValidElements.size())) {
+                framed_sample_t reframed;
+                unframe_sample(edited, output);
+                frame_sample(output.data(), output.size(), reframed);
+                selector_edits++;
+                if (reframed.messages.size() != framed.messages.size() ||
+                    generated_selector(output, i) != kValidSelectors[selector]) {
+                    selector_failures++;
+                }
+            }
+
+            edited = framed;
+            uint32_t size = 1 + next_random() % MAX_OOL_DATA_SIZE;
+            if (resize_ool_data(edited.messages[i], 0, size)) {
+                framed_sample_t reframed;
+                unframe_sample(edited, output);
+                frame_sample(output.data(), output.size(), reframed);
+                ool_edits++;
+                if (reframed.messages.size() != framed.messages.size() ||
+                    reframed.messages[i].trace.ool_count != record.trace.ool_count ||
+                    reframed.messages[i].trace.ool[0].data_size != size) {
+                    ool_failures++;
+                }
+            }
+        }
+    }
+
+    printf("inputs:          %zu (%llu messages)\n", inputs.size(), (unsigned long long)messages);
+    printf("round trip:      %llu failed\n", (unsigned long long)round_trip_failures);
+    printf("message count:   %llu failed\n", (unsigned long long)count_failures);
+    printf("selector edits:  %llu, %llu failed\n", (unsigned long long)selector_edits, (unsigned long long)selector_failures);
+    printf("OOL resizes:     %llu, %llu failed\n", (unsigned long long)ool_edits, (unsigned long long)ool_failures);
+
+    return round_trip_failures || count_failures || selector_failures || ool_failures ? 1 : 0;
+}
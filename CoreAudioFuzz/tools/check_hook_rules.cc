@@ -0,0 +1,256 @@
+/* 
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+// Checks jackalope-modifications/hook_spec against expected results:
+// - which lines ParseHookSpec rejects, and what it says about them,
+// - what EvaluateHookRules does with the arguments of a call: the skip and
+//   its return value, clamped arguments, which rules matched.
+//
+//   ./check_hook_rules [-v]
+//
+// -v prints every check. Exits with 1 if anything doesn't match.
+
+#include "hook_spec.h"
+
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static bool verbose_checks = false;
+static size_t checks = 0;
+static size_t failures = 0;
+
+#define CHECK(condition) check((condition), #condition, __LINE__)
+
+static void check(bool passed, const char *condition, int line) {
+    checks++;
+    if (!passed) {
+        printf("line %d: %s failed\n", line, condition);
+        failures++;
+    } else if (verbose_checks) {
+        printf("line %d: %s\n", line, condition);
+    }
+}
+
+// The error ParseHookSpec gives for spec, empty if it parses
+static std::string parse_error(const std::string& spec) {
+    std::vector<HookRule> rules;
+    std::string error;
+    if (ParseHookSpec(spec, &rules, &error)) {
+        return "";
+    }
+    return error.empty() ? "(no error)" : error;
+}
+
+static bool rejected(const std::string& spec, const std::string& error) {
+    std::string actual = parse_error(spec);
+    if (verbose_checks || actual.find(error) == std::string::npos) {
+        printf("  '%s': %s\n", spec.c_str(), actual.empty() ? "accepted" : actual.c_str());
+    }
+    return actual.find(error) != std::string::npos && actual.compare(0, 5, "line ") == 0;
+}
+
+static std::vector<HookRule> parse(const std::string& spec) {
+    std::vector<HookRule> rules;
+    std::string error;
+    if (!ParseHookSpec(spec, &rules, &error)) {
+        printf("  '%s': %s\n", spec.c_str(), error.c_str());
+    }
+    return rules;
+}
+
+static void check_parse() {
+    // Arguments: x86_64 passes six in registers
+    CHECK(rejected("M f 3 if arg6 == 0 skip", "expected arg0-arg5 in condition"));
+    CHECK(rejected("M f 3 if argx == 0 skip", "expected arg0-arg5 in condition"));
+    CHECK(rejected("M f 3 if arg10 == 0 skip", "expected arg0-arg5 in condition"));
+    CHECK(rejected("M f 3 if 2 == 0 skip", "expected arg0-arg5 in condition"));
+    CHECK(rejected("M f 3 clamp arg9 0 1", "expected clamp arg<N> <min> <max>"));
+    CHECK(rejected("M f 7 skip", "expected the number of arguments (0-6)"));
+
+    // Conditions
+    CHECK(rejected("M f 3 if arg0 =< 0 skip", "expected one of == != < <= > >= & in condition"));
+    CHECK(rejected("M f 3 if arg0 == zero skip", "expected a value in condition"));
+    CHECK(rejected("M f 3 if arg0 == 0 or arg1 == 0 skip", "unknown action 'or'"));
+
+    // Clamps
+    CHECK(rejected("M f 3 clamp arg1 10 5", "clamp minimum is above the maximum"));
+    CHECK(rejected("M f 3 clamp arg1 -1 0", "clamp minimum is above the maximum"));
+    CHECK(rejected("M f 3 clamp arg1 5", "expected clamp arg<N> <min> <max>"));
+
+    // Actions
+    CHECK(rejected("M f 3", "missing action"));
+    CHECK(rejected("M f 3 if arg0 == 0", "missing action"));
+    CHECK(rejected("M f 3 if arg0 == 0 and", "expected arg0-arg5 in condition"));
+    CHECK(rejected("M f 3 jump", "unknown action 'jump'"));
+    CHECK(rejected("M f 3 if arg0 == 0 return 1", "unknown action 'return'"));
+    CHECK(rejected("M f 3 skip zero", "expected a return value after skip"));
+
+    // Trailing tokens
+    CHECK(rejected("M f 3 skip 0 1", "unexpected '1' after action"));
+    CHECK(rejected("M f 3 count now", "unexpected 'now' after action"));
+    CHECK(rejected("M f 3 clamp arg0 0 1 2", "unexpected '2' after action"));
+
+    // Arguments the function wasn't declared with
+    CHECK(rejected("M f 2 if arg2 == 0 skip", "condition on arg2 of a 2 argument function"));
+    CHECK(rejected("M f 0 if arg0 != 0 count", "condition on arg0 of a 0 argument function"));
+    CHECK(rejected("M f 1 clamp arg1 0 1", "clamp of arg1 of a 1 argument function"));
+
+    // Too short to name a function, and where the error is reported
+    CHECK(rejected("M f", "expected <module> <symbol> <num_args>"));
+    CHECK(rejected("M f 3 skip\n\n# comment\nM g 3 if arg0 > 1 skipp\n", "line 4: unknown action 'skipp'"));
+
+    // What parses, and into what
+    std::vector<HookRule> rules = parse(
+        "# comment\n"
+        "\n"
+        "M f 3 if arg2 == 0 skip   # trailing comment\n"
+        "M f 3 if arg0 >= 0x10 and arg1 & 4 skip -1\n"
+        "  M   g  6  clamp  arg5  -0x10  -1  \n"
+        "M h 0 count\n");
+    CHECK(rules.size() == 4);
+    if (rules.size() == 4) {
+        CHECK(rules[0].line == 3);
+        CHECK(rules[0].action == HOOK_ACTION_SKIP && rules[0].return_value == 0);
+        CHECK(rules[0].conditions.size() == 1 && rules[0].conditions[0].arg == 2 &&
+              rules[0].conditions[0].op == HOOK_OP_EQ && rules[0].conditions[0].value == 0);
+        CHECK(rules[1].conditions.size() == 2 && rules[1].conditions[0].value == 0x10 &&
+              rules[1].conditions[1].op == HOOK_OP_MASK && rules[1].conditions[1].value == 4);
+        CHECK(rules[1].return_value == UINT64_MAX);
+        CHECK(rules[2].module == "M" && rules[2].symbol == "g" && rules[2].num_args == 6);
+        CHECK(rules[2].action == HOOK_ACTION_CLAMP && rules[2].clamp_arg == 5 &&
+              rules[2].clamp_min == (uint64_t)-0x10 && rules[2].clamp_max == UINT64_MAX);
+        CHECK(rules[3].action == HOOK_ACTION_COUNT && rules[3].conditions.empty());
+        CHECK(HookArgsUsed(rules) == ((1u << 0) | (1u << 1) | (1u << 2) | (1u << 5)));
+        CHECK(HookRuleToString(rules[1]) == "M f 3 if arg0 >= 16 and arg1 & 4 skip 0xffffffffffffffff");
+
+        std::vector<std::vector<HookRule>> groups = GroupHookRules(rules);
+        CHECK(groups.size() == 3 && groups[0].size() == 2 && groups[0][1].line == 4 && groups[1][0].symbol == "g");
+    }
+
+    // The rules print back to a spec that parses into the same rules
+    std::string printed;
+    for (const HookRule& rule : rules) {
+        printed += HookRuleToString(rule) + "\n";
+    }
+    std::vector<HookRule> reparsed = parse(printed);
+    CHECK(reparsed.size() == rules.size());
+    for (size_t i = 0; i < reparsed.size() && i < rules.size(); i++) {
+        CHECK(HookRuleToString(reparsed[i]) == HookRuleToString(rules[i]));
+    }
+
+    CHECK(parse_error(kDefaultHookSpec).empty());
+}
+
+static void check_evaluate() {
+    std::vector<HookRule> rules = parse(
+        "M f 3 if arg0 > 100 clamp arg0 0 100\n"
+        "M f 3 if arg1 & 4 skip 7\n"
+        "M f 3 count\n"
+        "M f 3 if arg2 == 0 skip -1\n"
+        "M f 3 count\n");
+    if (rules.size() != 5) {
+        CHECK(rules.size() == 5);
+        return;
+    }
+
+    // Clamped, then the last skip; the count after it isn't reached
+    uint64_t args[MAX_HOOK_ARGS] = {500, 0, 0};
+    HookOutcome outcome = EvaluateHookRules(rules, args);
+    CHECK(outcome.skip && outcome.return_value == UINT64_MAX);
+    CHECK(outcome.clamped == 1u << 0 && args[0] == 100);
+    CHECK(outcome.matched == ((1u << 0) | (1u << 2) | (1u << 3)));
+
+    // The first skip that matches stops the rest
+    uint64_t skip_args[MAX_HOOK_ARGS] = {5, 6, 0};
+    outcome = EvaluateHookRules(rules, skip_args);
+    CHECK(outcome.skip && outcome.return_value == 7);
+    CHECK(outcome.clamped == 0 && skip_args[0] == 5);
+    CHECK(outcome.matched == 1u << 1);
+
+    // Nothing skips: the function is called with its arguments
+    uint64_t call_args[MAX_HOOK_ARGS] = {100, 3, 1};
+    outcome = EvaluateHookRules(rules, call_args);
+    CHECK(!outcome.skip && outcome.return_value == 0);
+    CHECK(outcome.clamped == 0 && call_args[0] == 100);
+    CHECK(outcome.matched == ((1u << 2) | (1u << 4)));
+
+    CHECK(rules[0].hits == 1 && rules[1].hits == 1 && rules[2].hits == 2 && rules[3].hits == 1 && rules[4].hits == 1);
+
+    // Clamps change what later rules see
+    std::vector<HookRule> chained = parse(
+        "M g 2 clamp arg1 10 20\n"
+        "M g 2 if arg1 == 10 skip 1\n"
+        "M g 2 if arg1 == 3 skip 2\n");
+    uint64_t chained_args[MAX_HOOK_ARGS] = {0, 3};
+    outcome = EvaluateHookRules(chained, chained_args);
+    CHECK(outcome.skip && outcome.return_value == 1);
+    CHECK(outcome.clamped == 1u << 1 && chained_args[1] == 10);
+    CHECK(outcome.matched == ((1u << 0) | (1u << 1)));
+
+    // Every operator, at and either side of its value
+    struct {
+        const char *condition;
+        uint64_t arg;
+        bool holds;
+    } cases[] = {
+        {"arg0 == 5", 5, true},   {"arg0 == 5", 4, false},
+        {"arg0 != 5", 5, false},  {"arg0 != 5", 6, true},
+        {"arg0 < 5", 4, true},    {"arg0 < 5", 5, false},
+        {"arg0 <= 5", 5, true},   {"arg0 <= 5", 6, false},
+        {"arg0 > 5", 6, true},    {"arg0 > 5", 5, false},
+        {"arg0 >= 5", 5, true},   {"arg0 >= 5", 4, false},
+        {"arg0 & 0x18", 8, true}, {"arg0 & 0x18", 7, false},
+        {"arg0 > -2", UINT64_MAX, true}, {"arg0 < -1", UINT64_MAX, false},
+    };
+    for (const auto& test : cases) {
+        std::vector<HookRule> rule = parse(std::string("M h 1 if ") + test.condition + " skip 1");
+        uint64_t arg[MAX_HOOK_ARGS] = {test.arg};
+        bool skipped = !rule.empty() && EvaluateHookRules(rule, arg).skip;
+        if (skipped != test.holds) {
+            printf("  %s with arg0 = 0x%llx\n", test.condition, (unsigned long long)test.arg);
+        }
+        CHECK(skipped == test.holds);
+    }
+
+    // The built-in rule: _WriteSetting with a NULL arg2 returns 0
+    std::vector<HookRule> defaults = parse(kDefaultHookSpec);
+    uint64_t null_setting[MAX_HOOK_ARGS] = {0x1000, 0x2000, 0};
+    uint64_t setting[MAX_HOOK_ARGS] = {0x1000, 0x2000, 0x3000};
+    outcome = EvaluateHookRules(defaults, null_setting);
+    CHECK(outcome.skip && outcome.return_value == 0);
+    CHECK(!EvaluateHookRules(defaults, setting).skip);
+}
+
+int main(int argc, char *argv[]) {
+    int opt;
+    while ((opt = getopt(argc, argv, "v")) != -1) {
+        switch (opt) {
+            case 'v':
+                verbose_checks = true;
+                break;
+            default:
+                fprintf(stderr, "Usage: %s [-v]\n", argv[0]);
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    check_parse();
+    check_evaluate();
+
+    printf("checks:          %zu, %zu failed\n", checks, failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,121 @@
+/* 
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+// Parses a hook spec (jackalope-modifications/hook_spec.h) the way the
+// Jackalope fuzzer does, and prints the hooks it turns into. Given a symbol
+// and its arguments, runs that hook's rules on them instead, e.g.
+//
+//   ./check_hook_spec -s jackalope-modifications/hooks.spec
+//   ./check_hook_spec __ZN11HALS_System13_WriteSettingEP11HALS_ClientPK10__CFStringPKv arg2=0
+//
+// Without -s it uses the built-in spec. Exits with 1 if the spec doesn't
+// parse or nothing hooks the symbol.
+
+#include "hook_spec.h"
+
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void usage(const char *name) {
+    fprintf(stderr, "Usage: %s [-s spec] [symbol [argN=value ...]]\n", name);
+    exit(EXIT_FAILURE);
+}
+
+static void print_outcome(const std::vector<HookRule>& rules, const HookOutcome& outcome,
+                          const uint64_t *args) {
+    for (size_t i = 0; i < rules.size() && i < 32; i++) {
+        printf("%s line %d: %s\n", outcome.matched & (1u << i) ? "matched    " : "not matched",
+               rules[i].line, HookRuleToString(rules[i]).c_str());
+    }
+
+    for (int i = 0; i < MAX_HOOK_ARGS; i++) {
+        if (outcome.clamped & (1u << i)) {
+            printf("arg%d clamped to 0x%llx\n", i, (unsigned long long)args[i]);
+        }
+    }
+    if (outcome.skip) {
+        printf("skipped, returning 0x%llx\n", (unsigned long long)outcome.return_value);
+    } else {
+        printf("called\n");
+    }
+}
+
+int main(int argc, char *argv[]) {
+    const char *spec_path = NULL;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "s:")) != -1) {
+        switch (opt) {
+            case 's':
+                spec_path = optarg;
+                break;
+            default:
+                usage(argv[0]);
+        }
+    }
+
+    std::vector<HookRule> rules;
+    std::string error;
+    bool loaded = spec_path ? LoadHookSpec(spec_path, &rules, &error)
+                            : ParseHookSpec(kDefaultHookSpec, &rules, &error);
+    if (!loaded) {
+        fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+
+    std::vector<std::vector<HookRule>> hooks = GroupHookRules(rules);
+    if (optind == argc) {
+        for (const std::vector<HookRule>& hook : hooks) {
+            printf("%s!%s, %zu rule(s), reads", hook[0].module.c_str(), hook[0].symbol.c_str(), hook.size());
+            uint32_t used = HookArgsUsed(hook);
+            for (int i = 0; i < MAX_HOOK_ARGS; i++) {
+                if (used & (1u << i)) printf(" arg%d", i);
+            }
+            printf("%s\n", used ? "" : " nothing");
+            for (const HookRule& rule : hook) {
+                printf("  line %d: %s\n", rule.line, HookRuleToString(rule).c_str());
+            }
+        }
+        printf("%zu hooks\n", hooks.size());
+        return 0;
+    }
+
+    const char *symbol = argv[optind];
+    uint64_t args[MAX_HOOK_ARGS] = {};
+    for (int i = optind + 1; i < argc; i++) {
+        char *end;
+        if (strncmp(argv[i], "arg", 3) || argv[i][3] < '0' || argv[i][3] >= '0' + MAX_HOOK_ARGS || argv[i][4] != '=') {
+            usage(argv[0]);
+        }
+        args[argv[i][3] - '0'] = strtoull(argv[i] + 5, &end, 0);
+        if (*end) {
+            usage(argv[0]);
+        }
+    }
+
+    for (std::vector<HookRule>& hook : hooks) {
+        if (hook[0].symbol == symbol) {
+            HookOutcome outcome = EvaluateHookRules(hook, args);
+            print_outcome(hook, outcome, args);
+            return 0;
+        }
+    }
+
+    fprintf(stderr, "Nothing hooks %s\n", symbol);
+    return 1;
+}
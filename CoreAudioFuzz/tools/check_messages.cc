@@ -0,0 +1,199 @@
+/* 
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+// Checks generate_message() against golden byte layouts (golden_messages.h),
+// which were written by the vector based message writer that
+// helpers/message_writer.h replaced. Every routine in kMessageLayouts, and
+// two IDs outside the table, is generated from a fixed input of each size in
+// kInputSizes. Port names and OOL addresses differ from run to run, so they
+// are zeroed, and the bytes behind each OOL descriptor are compared instead.
+//
+//   ./check_messages [-v]
+//   ./check_messages -g > tools/golden_messages.h
+//
+// -v prints every message, -g writes the current layouts as the new golden
+// ones. Exits with 1 if anything doesn't match.
+
+#include "harness.h"
+#include "message_generator.h"
+
+#include <getopt.h>
+
+#include <string>
+
+typedef struct {
+    uint32_t msg_id;
+    uint32_t input_size;
+    const char *bytes;      // Hex, the message and then any OOL data
+} golden_message_t;
+
+#include "golden_messages.h"
+
+// The input runs out partway through the header at the second size
+static const size_t kInputSizes[] = {200, 20};
+
+static std::vector<uint32_t> message_ids() {
+    std::vector<uint32_t> ids;
+    for (uint32_t msg_id = kFirstMessageId; msg_id <= kLastMessageId; msg_id++) {
+        ids.push_back(msg_id);
+    }
+    ids.push_back(kLastMessageId + 1);
+    ids.push_back(1);
+    return ids;
+}
+
+static std::vector<uint8_t> make_input(uint32_t msg_id, size_t size) {
+    uint64_t state = 0x9e3779b97f4a7c15ULL ^ msg_id;
+    std::vector<uint8_t> input(size);
+    for (uint8_t& byte : input) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        byte = (uint8_t)state;
+    }
+    return input;
+}
+
+// The message with port names and OOL addresses zeroed, followed by the data
+// behind each OOL descriptor
+static std::vector<uint8_t> normalise(uint32_t msg_id, const uint8_t *data, size_t size) {
+    std::vector<uint8_t> message(data, data + size);
+    std::vector<uint8_t> ool_data;
+    const message_layout_t& layout = message_layout_for(msg_id);
+    size_t offset = MACH_MSG_HEADER_SIZE + sizeof(uint32_t);
+
+    for (uint32_t i = 0; layout.is_ool && i < layout.descriptor_count; i++) {
+        if (layout.descriptor_types[i] == MACH_MSG_PORT_DESCRIPTOR) {
+            if (offset + sizeof(mach_msg_port_descriptor_t) > size) break;
+            memset(&message[offset], 0, sizeof(mach_port_t));
+            offset += sizeof(mach_msg_port_descriptor_t);
+        } else {
+            if (offset + sizeof(mach_msg_ool_descriptor_t) > size) break;
+            uint64_t address;
+            uint32_t ool_size;
+            memcpy(&address, &message[offset], sizeof(address));
+            memcpy(&ool_size, &message[offset + offsetof(mach_msg_ool_descriptor_t, size)], sizeof(ool_size));
+            if (address) {
+                ool_data.insert(ool_data.end(), (const uint8_t *)address, (const uint8_t *)address + ool_size);
+            }
+            memset(&message[offset], 0, sizeof(address));
+            offset += sizeof(mach_msg_ool_descriptor_t);
+        }
+    }
+
+    message.insert(message.end(), ool_data.begin(), ool_data.end());
+    return message;
+}
+
+static std::vector<uint8_t> generate(uint32_t msg_id, size_t input_size) {
+    std::vector<uint8_t> input = make_input(msg_id, input_size);
+    FuzzedDataProvider fuzz_data(input.data(), input.size());
+    message_buffer_t& mach_msg = thread_message_buffer();
+    message_resources_t resources = {};
+
+    generate_message(msg_id, fuzz_data, mach_msg, resources);
+    std::vector<uint8_t> bytes = normalise(msg_id, mach_msg.data, mach_msg.size);
+    pool_release(resources);
+    return bytes;
+}
+
+static std::string to_hex(const std::vector<uint8_t>& bytes) {
+    std::string hex;
+    char digits[3];
+    for (uint8_t byte : bytes) {
+        snprintf(digits, sizeof(digits), "%02x", byte);
+        hex += digits;
+    }
+    return hex;
+}
+
+// The license block every source file starts with
+static const char kLicenseHeader[] =
+    "/* \n"
+    "Copyright 2025 Google LLC\n"
+    "\n"
+    "Licensed under the Apache License, Version 2.0 (the \"License\");\n"
+    "you may not use this file except in compliance with the License.\n"
+    "You may obtain a copy of the License at\n"
+    "\n"
+    "    https://www.apache.org/licenses/LICENSE-2.0\n"
+    "\n"
+    "Unless required by applicable law or agreed to in writing, software\n"
+    "distributed under the License is distributed on an \"AS IS\" BASIS,\n"
+    "WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.\n"
+    "See the License for the specific language governing permissions and\n"
+    "limitations under the License.\n"
+    "*/\n";
+
+static void write_golden(void) {
+    printf("%s\n", kLicenseHeader);
+    printf("// Golden layouts for tools/check_messages.cc, written by ./check_messages -g.\n\n");
+    printf("#ifndef GOLDEN_MESSAGES_H\n#define GOLDEN_MESSAGES_H\n\n");
+    printf("static const golden_message_t kGoldenMessages[] = {\n");
+    for (size_t input_size : kInputSizes) {
+        for (uint32_t msg_id : message_ids()) {
+            std::string hex = to_hex(generate(msg_id, input_size));
+            printf("    {%u, %zu,\n", msg_id, input_size);
+            for (size_t i = 0; i < hex.size(); i += 96) {
+                printf("     \"%s\"%s\n", hex.substr(i, 96).c_str(), i + 96 < hex.size() ? "" : "},");
+            }
+        }
+    }
+    printf("};\n\n#endif // GOLDEN_MESSAGES_H\n");
+}
+
+int main(int argc, char *argv[]) {
+    bool verbose_output = false;
+    int opt;
+    while ((opt = getopt(argc, argv, "gv")) != -1) {
+        switch (opt) {
+            case 'g':
+                write_golden();
+                return 0;
+            case 'v':
+                verbose_output = true;
+                break;
+            default:
+                fprintf(stderr, "Usage: %s [-v] | -g\n", argv[0]);
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    size_t failures = 0;
+    size_t count = sizeof(kGoldenMessages) / sizeof(kGoldenMessages[0]);
+    for (size_t i = 0; i < count; i++) {
+        const golden_message_t& golden = kGoldenMessages[i];
+        std::string expected = golden.bytes;
+        std::string actual = to_hex(generate(golden.msg_id, golden.input_size));
+
+        if (verbose_output) {
+            printf("%u/%u: %s\n", golden.msg_id, golden.input_size, actual.c_str());
+        }
+        if (actual != expected) {
+            size_t offset = 0;
+            while (offset < actual.size() && offset < expected.size() && actual[offset] == expected[offset]) {
+                offset++;
+            }
+            printf("%s (%u), %u byte input: differs at byte %zu (%zu bytes, expected %zu)\n",
+                   message_id_to_string((message_id_enum)golden.msg_id), golden.msg_id, golden.input_size,
+                   offset / 2, actual.size() / 2, expected.size() / 2);
+            failures++;
+        }
+    }
+
+    printf("messages:        %zu, %zu differ\n", count, failures);
+    return failures ? 1 : 0;
+}
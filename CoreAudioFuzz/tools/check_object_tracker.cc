@@ -0,0 +1,344 @@
+/* 
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+// Checks helpers/object_tracker against a scripted server: requests and
+// replies are built here, and sNextObjectID is a local counter, so nothing
+// goes through the mock. It checks
+// - which objects are tracked after create, GetObjectInfo, '!obj' and destroy
+//   replies,
+// - how the low bytes of the object ID in a request pick the ID sent,
+// - that messages with a shifted header are left alone.
+//
+//   ./check_object_tracker [-v]
+//
+// -v prints every check. Exits with 1 if anything doesn't match.
+
+#include "harness.h"
+#include "message_generator.h"
+#include "mock_processing.h"
+#include "object_tracker.h"
+
+#include <getopt.h>
+
+#include <set>
+
+static bool verbose_checks = false;
+static size_t checks = 0;
+static size_t failures = 0;
+
+#define CHECK(condition) check((condition), #condition, __LINE__)
+
+static void check(bool passed, const char *condition, int line) {
+    checks++;
+    if (!passed) {
+        printf("line %d: %s failed\n", line, condition);
+        failures++;
+    } else if (verbose_checks) {
+        printf("line %d: %s\n", line, condition);
+    }
+}
+
+static uint64_t next_object_id;
+static message_buffer_t request;
+
+// A well formed request for msg_id naming object_id
+static mach_msg_header_t *make_request(uint32_t msg_id, uint32_t object_id) {
+    const message_layout_t& layout = message_layout_for(msg_id);
+    mach_msg_header_t header = {};
+    header.msgh_size = layout.msg_size;
+    header.msgh_id = msg_id;
+
+    message_reset(request);
+    message_put(request, header);
+    message_resize(request, layout.msg_size);
+    if (object_kind_for(msg_id) != OBJECT_NONE) {
+        memcpy(request.data + object_id_offset(layout), &object_id, sizeof(uint32_t));
+    }
+    message_put_trailer(request);
+    return (mach_msg_header_t *)request.data;
+}
+
+static uint32_t request_object_id(uint32_t msg_id) {
+    uint32_t object_id;
+    memcpy(&object_id, request.data + object_id_offset(message_layout_for(msg_id)), sizeof(uint32_t));
+    return object_id;
+}
+
+// The object ID object_tracker_apply() sends for raw
+static uint32_t applied(uint32_t msg_id, uint32_t raw) {
+    make_request(msg_id, raw);
+    object_tracker_apply(msg_id, request);
+    return request_object_id(msg_id);
+}
+
+// Sends msg_id for object_id and has the server answer with ret_code
+static void reply(uint32_t msg_id, uint32_t object_id, int32_t ret_code) {
+    mock_reply_t reply = {};
+    reply.header.msgh_size = sizeof(reply);
+    reply.header.msgh_id = msg_id + 100;
+    reply.ret_code = ret_code;
+
+    object_tracker_observe(msg_id, make_request(msg_id, object_id), &reply.header);
+}
+
+// Like XSystem_CreateIOContext and friends: the server hands out count IDs
+static void create(uint32_t msg_id, uint32_t count) {
+    mock_create_reply_t reply = {};
+    reply.header.msgh_size = sizeof(reply);
+    reply.header.msgh_id = msg_id + 100;
+    reply.object_id = (uint32_t)next_object_id;
+
+    make_request(msg_id, 0);
+    object_tracker_apply(msg_id, request);
+    next_object_id += count;
+    object_tracker_observe(msg_id, (mach_msg_header_t *)request.data, &reply.header);
+}
+
+static void object_info(uint32_t object_id, uint32_t object_class, uint32_t base_class) {
+    mock_object_info_reply_t reply = {};
+    reply.header.msgh_size = sizeof(reply);
+    reply.header.msgh_id = XSystem_GetObjectInfo + 100;
+    reply.object_class = object_class;
+    reply.base_class = base_class;
+
+    object_tracker_observe(XSystem_GetObjectInfo, make_request(XSystem_GetObjectInfo, object_id), &reply.header);
+}
+
+static const tracked_object_t *tracked(uint32_t object_id) {
+    for (size_t i = 0; i < object_tracker_count(); i++) {
+        if (object_tracker_objects()[i].object_id == object_id) {
+            return &object_tracker_objects()[i];
+        }
+    }
+    return NULL;
+}
+
+static std::set<uint32_t> tracked_ids() {
+    std::set<uint32_t> ids;
+    for (size_t i = 0; i < object_tracker_count(); i++) {
+        ids.insert(object_tracker_objects()[i].object_id);
+    }
+    return ids;
+}
+
+static object_kind_t tracked_kind(uint32_t object_id) {
+    const tracked_object_t *object = tracked(object_id);
+    return object ? object->kind : OBJECT_NONE;
+}
+
+// Object ID bytes: the low byte picks where the ID comes from, the next two
+// bits whether the routine's kind matters, the rest which object
+static uint32_t raw_id(uint32_t choice, bool any_kind, uint32_t n) {
+    return choice | (any_kind ? 0 : 1u << 8) | n << 10;
+}
+
+static void check_tracked_ids() {
+    object_tracker_reset();
+    next_object_id = 10;
+    CHECK(tracked_ids() == std::set<uint32_t>({SYSTEM_OBJECT_ID}));
+    CHECK(tracked_kind(SYSTEM_OBJECT_ID) == OBJECT_SYSTEM);
+
+    // Whatever sNextObjectID moves past is created by the message, the first
+    // one being what the routine creates
+    create(XSystem_CreateIOContext, 1);
+    create(XSystem_CreateMetaDevice, 3);
+    CHECK(tracked_ids() == std::set<uint32_t>({1, 10, 11, 12, 13}));
+    CHECK(tracked_kind(10) == OBJECT_IO_CONTEXT);
+    CHECK(tracked_kind(11) == OBJECT_META_DEVICE);
+    CHECK(tracked_kind(12) == OBJECT_ANY);
+    CHECK(object_tracker_stats().created == 4);
+
+    // An object the tracker didn't see created is learnt when a routine
+    // accepts it, and its kind from the routine or its class
+    reply(XObject_HasProperty, 5, 0);
+    reply(XIOContext_Start, 6, 0);
+    reply(XObject_HasProperty, 7, MIG_BAD_ARGUMENTS);
+    object_info(12, 'adev', 'aobj');
+    object_info(13, 'abcd', 'adev');
+    object_info(5, 'aagg', 'adev');
+    CHECK(tracked_ids() == std::set<uint32_t>({1, 5, 6, 10, 11, 12, 13}));
+    CHECK(tracked_kind(5) == OBJECT_META_DEVICE);
+    CHECK(tracked_kind(6) == OBJECT_IO_CONTEXT);
+    CHECK(tracked_kind(12) == OBJECT_DEVICE);
+    CHECK(tracked_kind(13) == OBJECT_DEVICE);
+    CHECK(tracked(12)->object_class == 'adev');
+    CHECK(object_tracker_stats().confirmed == 2);
+
+    // The object lookup also fails on a live object of the wrong kind, so
+    // '!obj' only removes objects of the routine's kind, or from routines
+    // that take any object
+    reply(XIOContext_Start, 11, BAD_OBJECT_ERROR);
+    CHECK(tracked(11) != NULL);
+    reply(XIOContext_Start, 6, BAD_OBJECT_ERROR);
+    reply(XObject_HasProperty, 12, BAD_OBJECT_ERROR);
+    reply(XObject_HasProperty, SYSTEM_OBJECT_ID, BAD_OBJECT_ERROR);
+    CHECK(tracked_ids() == std::set<uint32_t>({1, 5, 10, 11, 13}));
+
+    // Destroy routines remove their object once they succeed
+    reply(XSystem_DestroyIOContext, 10, MIG_BAD_ARGUMENTS);
+    CHECK(tracked(10) != NULL);
+    reply(XSystem_DestroyIOContext, 10, 0);
+    reply(XSystem_DestroyMetaDevice, 11, 0);
+    CHECK(tracked_ids() == std::set<uint32_t>({1, 5, 13}));
+    CHECK(object_tracker_stats().removed == 4);
+
+    // A message creating more than the limit still has its own object
+    // recorded, with its kind, next to the last ones
+    object_tracker_reset();
+    next_object_id = 30;
+    create(XSystem_CreateMetaDevice, 40);
+    CHECK(object_tracker_count() == 1 + MAX_CREATED_PER_MESSAGE);
+    CHECK(tracked_kind(30) == OBJECT_META_DEVICE);
+    CHECK(tracked(31) == NULL);
+    CHECK(tracked_kind(69) == OBJECT_ANY);
+    CHECK(object_tracker_stats().created == MAX_CREATED_PER_MESSAGE);
+
+    // Full: the oldest objects go first, the system object stays
+    object_tracker_reset();
+    next_object_id = 100;
+    create(XSystem_CreateIOContext, 1);
+    for (uint32_t i = 0; i < MAX_TRACKED_OBJECTS; i++) {
+        reply(XObject_HasProperty, 1000 + i, 0);
+    }
+    CHECK(object_tracker_count() == MAX_TRACKED_OBJECTS);
+    CHECK(tracked(SYSTEM_OBJECT_ID) != NULL);
+    CHECK(tracked(100) == NULL);
+    CHECK(tracked(1000) == NULL);
+    CHECK(tracked(1001) != NULL);
+    CHECK(tracked(1000 + MAX_TRACKED_OBJECTS - 1) != NULL);
+}
+
+static void check_selection() {
+    object_tracker_reset();
+    next_object_id = 50;
+    create(XSystem_CreateIOContext, 1);
+    create(XSystem_CreateIOContext, 1);
+    create(XSystem_CreateMetaDevice, 1);
+    const std::set<uint32_t> live = {1, 50, 51, 52};
+    CHECK(tracked_ids() == live);
+
+    // Low byte below 208: a tracked object, of the routine's kind unless the
+    // kind bits are clear. An all zero ID picks the first one.
+    std::set<uint32_t> io_contexts, any_kind;
+    for (uint32_t n = 0; n < 16; n++) {
+        io_contexts.insert(applied(XIOContext_Start, raw_id(n % 208, false, n)));
+        any_kind.insert(applied(XIOContext_Start, raw_id(207, true, n)));
+    }
+    CHECK(io_contexts == std::set<uint32_t>({50, 51}));
+    CHECK(any_kind == live);
+    CHECK(applied(XIOContext_Start, 0) == SYSTEM_OBJECT_ID);
+    CHECK(applied(XSystem_DestroyMetaDevice, raw_id(0, false, 7)) == 52);
+
+    // No object of the routine's kind: any tracked one
+    CHECK(live.count(applied(XTransportManager_CreateDevice, raw_id(0, false, 3))));
+
+    // 208 up to 240: any ID the server has handed out
+    std::set<uint32_t> probed;
+    for (uint32_t n = 0; n < 1024; n++) {
+        probed.insert(applied(XObject_HasProperty, 208 + n % 32 + (n << 8)));
+    }
+    CHECK(*probed.begin() == SYSTEM_OBJECT_ID);
+    CHECK(*probed.rbegin() == next_object_id - 1);
+    CHECK(probed.size() == next_object_id - SYSTEM_OBJECT_ID);
+
+    // Unless the server hasn't handed out any, then a tracked one
+    uint64_t *saved = NextObjectID;
+    NextObjectID = NULL;
+    CHECK(live.count(applied(XObject_HasProperty, raw_id(220, true, 100))));
+    NextObjectID = saved;
+
+    // 240 and up: kept
+    CHECK(applied(XObject_HasProperty, raw_id(240, true, 12345)) == raw_id(240, true, 12345));
+    CHECK(applied(XObject_HasProperty, 0xffffffff) == 0xffffffff);
+
+    // Off
+    object_tracking = false;
+    CHECK(applied(XObject_HasProperty, raw_id(0, true, 1)) == raw_id(0, true, 1));
+    object_tracking = true;
+
+    // Routines without an object ID are left as they are
+    make_request(XSystem_Open, 0);
+    std::vector<uint8_t> before(request.data, request.data + request.size);
+    object_tracker_apply(XSystem_Open, request);
+    CHECK(std::vector<uint8_t>(request.data, request.data + request.size) == before);
+
+    const object_tracker_stats_t& stats = object_tracker_stats();
+    CHECK(stats.tracked == 32 + 2 + 1 + 1);
+    CHECK(stats.probed == 1024);
+    CHECK(stats.kept == 2);
+}
+
+// Once the input runs out the ports come up short, and msg_id lands before
+// msgh_id. The server dispatches on what is at msgh_id, so the tracker must
+// neither rewrite the bytes where msg_id's object ID would be nor learn from
+// the reply.
+static void check_shifted_header() {
+    object_tracker_reset();
+    next_object_id = 20;
+    create(XSystem_CreateIOContext, 1);
+
+    uint8_t input[] = {0xff, 0xff, 0xff, 0xff, 0x01, 0x02, 0x03, 0x04, 0x05};
+    FuzzedDataProvider fuzz_data(input, sizeof(input));
+    message_resources_t resources = {};
+    generate_message(XIOContext_Start, fuzz_data, request, resources);
+
+    const mach_msg_header_t *header = (const mach_msg_header_t *)request.data;
+    CHECK(header->msgh_id != XIOContext_Start);
+
+    uint32_t offset = object_id_offset(message_layout_for(XIOContext_Start));
+    uint32_t object_id = 20;
+    memcpy(request.data + offset, &object_id, sizeof(uint32_t));
+    std::vector<uint8_t> before(request.data, request.data + request.size);
+    object_tracker_apply(XIOContext_Start, request);
+    CHECK(std::vector<uint8_t>(request.data, request.data + request.size) == before);
+
+    mock_reply_t reply = {};
+    reply.header.msgh_size = sizeof(reply);
+    reply.ret_code = BAD_OBJECT_ERROR;
+    object_tracker_observe(XIOContext_Start, header, &reply.header);
+    CHECK(tracked_kind(20) == OBJECT_IO_CONTEXT);
+
+    reply.ret_code = 0;
+    memcpy(request.data + offset, &(object_id = 30), sizeof(uint32_t));
+    object_tracker_observe(XIOContext_Start, header, &reply.header);
+    CHECK(tracked(30) == NULL);
+
+    pool_release(resources);
+}
+
+int main(int argc, char *argv[]) {
+    int opt;
+    while ((opt = getopt(argc, argv, "v")) != -1) {
+        switch (opt) {
+            case 'v':
+                verbose_checks = true;
+                break;
+            default:
+                fprintf(stderr, "Usage: %s [-v]\n", argv[0]);
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    // The scripted server's sNextObjectID, instead of the mock's
+    NextObjectID = &next_object_id;
+
+    check_tracked_ids();
+    check_selection();
+    check_shifted_header();
+
+    printf("checks:          %zu, %zu failed\n", checks, failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,477 @@
+/* 
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+// Decodes harness inputs offline. The tool consumes each sample with
+// consume_message_id() and generate_message(), exactly as
+// LLVMFuzzerTestOneInput does, but never sends anything. It reports the
+// messages every sample turns into and statistics over the whole corpus.
+//
+//   ./decode_corpus [-j threads] [-r records.tsv] sample_or_directory ...
+//
+// Directories are walked recursively (unzip corpus.zip first). With -r, one
+// tab separated record per message is written, in sample order:
+//
+//   sample  index  msg_id  name  msgh_size  complete  object_id  selector  scope  element  ool_sizes
+//
+// Fields that don't apply are "-". object_id is what the sample says; the
+// harness's object tracker may send a live object's ID instead.
+
+#include "harness.h"
+#include "message_generator.h"
+#include "tool_util.h"
+
+#include <algorithm>
+#include <atomic>
+#include <dirent.h>
+#include <getopt.h>
+#include <string>
+#include <sys/stat.h>
+#include <thread>
+
+// Samples decoded between writes of their records
+#define BATCH_SIZE 4096
+
+// OOL sizes in powers of two: 0, 1, 2-3, 4-7, ..., 512-1023, 1024
+#define OOL_SIZE_BUCKETS 12
+
+static const char kPlistPrefix[] = "<?xml version=";
+
+typedef struct {
+    uint32_t msg_id;
+    uint32_t size;                  // msgh_size
+    bool complete;
+    bool has_object;
+    uint32_t object_id;
+    bool has_selector;
+    bool chose_selector;            // the generator picked from kValidSelectors & co.
+    uint32_t selector;
+    uint32_t scope;
+    uint32_t element;
+    uint32_t ool_count;
+    uint32_t ool_sizes[MAX_LAYOUT_DESCRIPTORS];
+    bool ool_plist[MAX_LAYOUT_DESCRIPTORS];
+} decoded_message_t;
+
+struct corpus_stats_t {
+    uint64_t samples = 0;
+    uint64_t bytes = 0;
+    uint64_t unreadable = 0;
+    uint64_t messages = 0;
+    uint64_t incomplete = 0;
+    uint64_t msg_ids[kMessageIdCount + 1] = {};     // the last one counts IDs outside the table
+    uint64_t with_selector = 0;
+    uint64_t chosen_selectors = 0;
+    std::vector<uint64_t> selectors = std::vector<uint64_t>(kValidSelectors.size());
+    std::vector<uint64_t> scopes = std::vector<uint64_t>(kValidScopes.size());
+    std::vector<uint64_t> routine_selectors = std::vector<uint64_t>(kMessageIdCount * kValidSelectors.size());
+    uint64_t ool_descriptors = 0;
+    uint64_t ool_plists = 0;
+    uint64_t ool_bytes = 0;
+    uint64_t ool_sizes[OOL_SIZE_BUCKETS] = {};
+
+    void merge(const corpus_stats_t& other) {
+        samples += other.samples;
+        bytes += other.bytes;
+        unreadable += other.unreadable;
+        messages += other.messages;
+        incomplete += other.incomplete;
+        for (uint32_t i = 0; i <= kMessageIdCount; i++) msg_ids[i] += other.msg_ids[i];
+        with_selector += other.with_selector;
+        chosen_selectors += other.chosen_selectors;
+        for (size_t i = 0; i < selectors.size(); i++) selectors[i] += other.selectors[i];
+        for (size_t i = 0; i < scopes.size(); i++) scopes[i] += other.scopes[i];
+        for (size_t i = 0; i < routine_selectors.size(); i++) routine_selectors[i] += other.routine_selectors[i];
+        ool_descriptors += other.ool_descriptors;
+        ool_plists += other.ool_plists;
+        ool_bytes += other.ool_bytes;
+        for (uint32_t i = 0; i < OOL_SIZE_BUCKETS; i++) ool_sizes[i] += other.ool_sizes[i];
+    }
+};
+
+static void collect_samples(const std::string& path, std::vector<std::string>& samples) {
+    struct stat st;
+    if (stat(path.c_str(), &st) != 0) {
+        perror(path.c_str());
+        return;
+    }
+
+    if (!S_ISDIR(st.st_mode)) {
+        samples.push_back(path);
+        return;
+    }
+
+    DIR *dir = opendir(path.c_str());
+    if (!dir) {
+        perror(path.c_str());
+        return;
+    }
+
+    std::vector<std::string> entries;
+    while (struct dirent *entry = readdir(dir)) {
+        if (entry->d_name[0] != '.') {
+            entries.push_back(path + "/" + entry->d_name);
+        }
+    }
+    closedir(dir);
+
+    std::sort(entries.begin(), entries.end());
+    for (const std::string& entry : entries) {
+        collect_samples(entry, samples);
+    }
+}
+
+// Read the message back out of the buffer generate_message() filled in
+static void decode_message(const message_buffer_t& mach_msg, const message_trace_t& trace,
+                           const message_resources_t& resources, decoded_message_t& decoded) {
+    const mach_msg_header_t *header = (const mach_msg_header_t *)mach_msg.data;
+    const message_layout_t& layout = message_layout_for(header->msgh_id);
+    uint32_t end = mach_msg.size - MACH_MSG_TRAILER_SIZE;
+
+    decoded.msg_id = header->msgh_id;
+    decoded.size = header->msgh_size;
+
+    uint32_t object_offset = object_id_offset(layout);
+    decoded.has_object = object_kind_for(decoded.msg_id) != OBJECT_NONE && object_offset + sizeof(uint32_t) <= end;
+    if (decoded.has_object) {
+        memcpy(&decoded.object_id, mach_msg.data + object_offset, sizeof(uint32_t));
+    }
+
+    decoded.has_selector = layout.has_selector && end >= MACH_MSG_HEADER_SIZE + 16;
+    decoded.chose_selector = decoded.has_selector && trace.selector_bytes == 11;
+    if (decoded.has_selector) {
+        memcpy(&decoded.selector, mach_msg.data + end - 16, sizeof(uint32_t));
+        memcpy(&decoded.scope, mach_msg.data + end - 12, sizeof(uint32_t));
+        memcpy(&decoded.element, mach_msg.data + end - 8, sizeof(uint32_t));
+    }
+
+    decoded.ool_count = 0;
+    if (!(header->msgh_bits & MACH_MSGH_BITS_COMPLEX) || end < MACH_MSG_HEADER_SIZE + sizeof(uint32_t)) {
+        return;
+    }
+
+    uint32_t descriptor_count;
+    uint32_t offset = MACH_MSG_HEADER_SIZE;
+    memcpy(&descriptor_count, mach_msg.data + offset, sizeof(uint32_t));
+    offset += sizeof(uint32_t);
+
+    for (uint32_t i = 0; i < descriptor_count && i < MAX_LAYOUT_DESCRIPTORS; i++) {
+        // Every descriptor type keeps its type in the same place
+        mach_msg_type_descriptor_t type_descriptor;
+        if (offset + sizeof(type_descriptor) > end) {
+            return;
+        }
+        memcpy(&type_descriptor, mach_msg.data + offset, sizeof(type_descriptor));
+
+        if (type_descriptor.type == MACH_MSG_PORT_DESCRIPTOR) {
+            offset += sizeof(mach_msg_port_descriptor_t);
+            continue;
+        }
+
+        mach_msg_ool_descriptor_t ool;
+        if (offset + sizeof(ool) > end) {
+            return;
+        }
+        memcpy(&ool, mach_msg.data + offset, sizeof(ool));
+        offset += sizeof(ool);
+
+        // Descriptors of messages with a fuzzed size can be overwritten by
+        // the body, only count those that still point at our buffers
+        void *const *buffers_end = resources.ool_buffers + resources.ool_buffer_count;
+        if (ool.type == MACH_MSG_OOL_DESCRIPTOR && std::find(resources.ool_buffers, buffers_end, ool.address) != buffers_end) {
+            decoded.ool_sizes[decoded.ool_count] = ool.size;
+            decoded.ool_plist[decoded.ool_count] = ool.size >= sizeof(kPlistPrefix) &&
+                !memcmp(ool.address, kPlistPrefix, sizeof(kPlistPrefix) - 1);
+            decoded.ool_count++;
+        }
+    }
+}
+
+static int index_of(const std::vector<uint32_t>& values, uint32_t value) {
+    auto it = std::find(values.begin(), values.end(), value);
+    return it == values.end() ? -1 : (int)(it - values.begin());
+}
+
+static void count_message(const decoded_message_t& decoded, corpus_stats_t& stats) {
+    uint32_t index = decoded.msg_id - kFirstMessageId;
+    if (index >= kMessageIdCount) {
+        index = kMessageIdCount;
+    }
+
+    stats.messages++;
+    stats.incomplete += !decoded.complete;
+    stats.msg_ids[index]++;
+
+    if (decoded.has_selector) {
+        stats.with_selector++;
+    }
+    if (decoded.chose_selector) {
+        int selector = index_of(kValidSelectors, decoded.selector);
+        int scope = index_of(kValidScopes, decoded.scope);
+        stats.chosen_selectors++;
+        if (selector >= 0) {
+            stats.selectors[selector]++;
+            if (index < kMessageIdCount) {
+                stats.routine_selectors[index * kValidSelectors.size() + selector]++;
+            }
+        }
+        if (scope >= 0) {
+            stats.scopes[scope]++;
+        }
+    }
+
+    for (uint32_t i = 0; i < decoded.ool_count; i++) {
+        uint32_t size = decoded.ool_sizes[i];
+        uint32_t bucket = 0;
+        while (bucket < OOL_SIZE_BUCKETS - 1 && size >= (1u << bucket)) {
+            bucket++;
+        }
+        stats.ool_descriptors++;
+        stats.ool_plists += decoded.ool_plist[i];
+        stats.ool_bytes += size;
+        stats.ool_sizes[bucket]++;
+    }
+}
+
+static void append_fourcc(std::string& out, uint32_t value) {
+    char text[16];
+    bool printable = true;
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        char c = (char)(value >> shift);
+        printable &= c >= 0x20 && c < 0x7f;
+    }
+
+    if (printable) {
+        snprintf(text, sizeof(text), "%c%c%c%c", (char)(value >> 24), (char)(value >> 16), (char)(value >> 8), (char)value);
+    } else {
+        snprintf(text, sizeof(text), "0x%08x", value);
+    }
+    out += text;
+}
+
+static void append_record(std::string& out, const char *sample, size_t index, const decoded_message_t& decoded) {
+    char text[256];
+    snprintf(text, sizeof(text), "%s\t%zu\t%u\t%s\t%u\t%d\t", sample, index, decoded.msg_id,
+             message_id_to_string(static_cast<message_id_enum>(decoded.msg_id)), decoded.size, decoded.complete);
+    out += text;
+
+    if (decoded.has_object) {
+        snprintf(text, sizeof(text), "%u\t", decoded.object_id);
+        out += text;
+    } else {
+        out += "-\t";
+    }
+
+    if (decoded.has_selector) {
+        append_fourcc(out, decoded.selector);
+        out += '\t';
+        append_fourcc(out, decoded.scope);
+        snprintf(text, sizeof(text), "\t0x%x\t", decoded.element);
+        out += text;
+    } else {
+        out += "-\t-\t-\t";
+    }
+
+    if (decoded.ool_count == 0) {
+        out += '-';
+    }
+    for (uint32_t i = 0; i < decoded.ool_count; i++) {
+        snprintf(text, sizeof(text), "%s%u%s", i ? "," : "", decoded.ool_sizes[i], decoded.ool_plist[i] ? "p" : "");
+        out += text;
+    }
+    out += '\n';
+}
+
+// The same loop as LLVMFuzzerTestOneInput, minus sending
+static void decode_sample(const char *name, const std::vector<uint8_t>& sample, corpus_stats_t& stats, std::string *records) {
+    FuzzedDataProvider fuzz_data(sample.data(), sample.size());
+    message_buffer_t& mach_msg = thread_message_buffer();
+    static thread_local message_resources_t resources;
+    bool first = true;
+
+    stats.samples++;
+    stats.bytes += sample.size();
+
+    for (size_t index = 0; fuzz_data.remaining_bytes() >= MACH_MSG_HEADER_SIZE; index++) {
+        uint32_t msg_id = consume_message_id(fuzz_data, first);
+        first = false;
+
+        message_trace_t trace;
+        decoded_message_t decoded = {};
+        generate_message(msg_id, fuzz_data, mach_msg, resources, &trace);
+        decode_message(mach_msg, trace, resources, decoded);
+        decoded.complete = fuzz_data.remaining_bytes() > 0;
+        pool_release(resources);
+
+        count_message(decoded, stats);
+        if (records) {
+            append_record(*records, name, index, decoded);
+        }
+    }
+}
+
+static void print_stats(const corpus_stats_t& stats) {
+    printf("\nmessages by ID:\n");
+    for (uint32_t i = 0; i <= kMessageIdCount; i++) {
+        const char *name = i < kMessageIdCount ? message_id_to_string(static_cast<message_id_enum>(kFirstMessageId + i))
+                                               : "(outside the table)";
+        printf("  %7u  %-86s %10llu  %5.2f%%\n", kFirstMessageId + i, name, (unsigned long long)stats.msg_ids[i],
+               stats.messages ? 100.0 * stats.msg_ids[i] / stats.messages : 0.0);
+    }
+
+    uint32_t never_sent = 0;
+    for (uint32_t i = 0; i < kMessageIdCount; i++) {
+        never_sent += stats.msg_ids[i] == 0;
+    }
+    printf("  %u of %u routines never sent\n", never_sent, kMessageIdCount);
+
+    printf("\nselectors: %llu messages end in a selector triple, %llu picked from the valid values\n",
+           (unsigned long long)stats.with_selector, (unsigned long long)stats.chosen_selectors);
+    for (size_t i = 0; i < kValidSelectors.size(); i++) {
+        std::string name;
+        append_fourcc(name, kValidSelectors[i]);
+        printf("  %-10s %10llu\n", name.c_str(), (unsigned long long)stats.selectors[i]);
+    }
+
+    size_t routines = 0, pairs = 0;
+    for (uint32_t i = 0; i < kMessageIdCount; i++) {
+        if (!kMessageLayouts[i].has_selector) {
+            continue;
+        }
+        routines++;
+        for (size_t j = 0; j < kValidSelectors.size(); j++) {
+            pairs += stats.routine_selectors[i * kValidSelectors.size() + j] > 0;
+        }
+    }
+    printf("  routine/selector pairs: %zu of %zu\n", pairs, routines * kValidSelectors.size());
+
+    printf("\nscopes:\n");
+    for (size_t i = 0; i < kValidScopes.size(); i++) {
+        std::string name;
+        append_fourcc(name, kValidScopes[i]);
+        printf("  %-10s %10llu\n", name.c_str(), (unsigned long long)stats.scopes[i]);
+    }
+
+    printf("\nOOL data: %llu descriptors, %llu canned plists, %.1f bytes on average\n",
+           (unsigned long long)stats.ool_descriptors, (unsigned long long)stats.ool_plists,
+           stats.ool_descriptors ? (double)stats.ool_bytes / stats.ool_descriptors : 0.0);
+    for (uint32_t i = 0; i < OOL_SIZE_BUCKETS; i++) {
+        char range[32];
+        if (i < 2 || i == OOL_SIZE_BUCKETS - 1) {
+            snprintf(range, sizeof(range), "%u%s", i ? 1u << (i - 1) : 0, i == OOL_SIZE_BUCKETS - 1 ? "+" : "");
+        } else {
+            snprintf(range, sizeof(range), "%u-%u", 1u << (i - 1), (1u << i) - 1);
+        }
+        printf("  %-10s %10llu\n", range, (unsigned long long)stats.ool_sizes[i]);
+    }
+}
+
+int main(int argc, char *argv[]) {
+    unsigned thread_count = std::max(1u, std::thread::hardware_concurrency());
+    const char *records_path = NULL;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "j:r:")) != -1) {
+        switch (opt) {
+            case 'j':
+                thread_count = std::max(1ul, strtoul(optarg, NULL, 0));
+                break;
+            case 'r':
+                records_path = optarg;
+                break;
+            default:
+                fprintf(stderr, "Usage: %s [-j threads] [-r records.tsv] sample_or_directory ...\n", argv[0]);
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    std::vector<std::string> samples;
+    for (int i = optind; i < argc; i++) {
+        collect_samples(argv[i], samples);
+    }
+    if (samples.empty()) {
+        fprintf(stderr, "No samples\n");
+        return 1;
+    }
+
+    FILE *records_file = NULL;
+    if (records_path) {
+        records_file = !strcmp(records_path, "-") ? stdout : fopen(records_path, "w");
+        if (!records_file) {
+            perror(records_path);
+            return 1;
+        }
+    }
+
+    std::vector<corpus_stats_t> thread_stats(thread_count);
+    std::vector<std::string> records(records_file ? BATCH_SIZE : 0);
+    double start = now_seconds();
+
+    for (size_t batch = 0; batch < samples.size(); batch += BATCH_SIZE) {
+        size_t batch_end = std::min(batch + BATCH_SIZE, samples.size());
+        std::atomic<size_t> next_sample(batch);
+        std::vector<std::thread> threads;
+
+        for (unsigned t = 0; t < thread_count; t++) {
+            threads.emplace_back([&, t]() {
+                std::vector<uint8_t> sample;
+                size_t i;
+                while ((i = next_sample++) < batch_end) {
+                    std::string *out = records_file ? &records[i - batch] : NULL;
+                    if (out) {
+                        out->clear();
+                    }
+                    if (!read_sample(samples[i].c_str(), sample)) {
+                        thread_stats[t].unreadable++;
+                        continue;
+                    }
+                    decode_sample(samples[i].c_str(), sample, thread_stats[t], out);
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        for (size_t i = batch; records_file && i < batch_end; i++) {
+            fwrite(records[i - batch].data(), 1, records[i - batch].size(), records_file);
+        }
+    }
+
+    double elapsed = now_seconds() - start;
+    if (records_file && records_file != stdout) {
+        fclose(records_file);
+    }
+
+    corpus_stats_t stats;
+    for (const corpus_stats_t& s : thread_stats) {
+        stats.merge(s);
+    }
+
+    // Keep the statistics out of the way of records going to stdout
+    if (records_file == stdout) {
+        return 0;
+    }
+
+    printf("samples:       %llu (%.1f MB, %llu unreadable) in %.2fs with %u threads (%.0f/s)\n",
+           (unsigned long long)stats.samples, stats.bytes / 1e6, (unsigned long long)stats.unreadable, elapsed,
+           thread_count, stats.samples / elapsed);
+    printf("messages:      %llu (%.1f per sample, %llu cut short by the end of the sample)\n",
+           (unsigned long long)stats.messages, stats.samples ? (double)stats.messages / stats.samples : 0.0,
+           (unsigned long long)stats.incomplete);
+    print_stats(stats);
+
+    return 0;
+}
@@ -0,0 +1,1160 @@
+/* 
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+// Golden layouts for tools/check_messages.cc, written by the vector based
+// message writer that helpers/message_writer.h replaced, in the format of
+// ./check_messages -g.
+
+#ifndef GOLDEN_MESSAGES_H
+#define GOLDEN_MESSAGES_H
+
+static const golden_message_t kGoldenMessages[] = {
+    {1010000, 200,
+     "fb822ba3380000002f33d93a06b4a9e49b76588050690f0001000000000000003d67cdfc5b2f1100936a76f243af58ee"
+     "f18e6fcfd2b5cc1900000000200000000000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000"},
+    {1010001, 200,
+     "1945633b180000006e72f01f63b5d8e96458bc0951690f00000000002000000000000000000000000000000000000000"
+     "00000000000000000000000000000000000000000000000000000000"},
+    {1010002, 200,
+     "9b32345224000000adb0cb78a4b70e9c377395fc52690f007f83f2af0c1a5e8c6b3d6fb3000000002000000000000000"
+     "00000000000000000000000000000000000000000000000000000000000000000000000000000000"},
+    {1010003, 200,
+     "79f57cca38000000ecf1e25dc1b67f91c85d717553690f000100000000000000000000000102170146010000992016d4"
+     "292bf1d04601000000000000200000000000000000000000000000000000000000000000000000000000000000000000"
+     "0000000000000000000000003c3f786d6c2076657273696f6e3d22312e302220656e636f64696e673d225554462d3822"
+     "3f3e3c21444f435459504520706c697374205055424c494320222d2f2f4170706c652f2f44544420504c49535420312e"
+     "302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d2f445444732f50726f70657274794c6973742d31"
+     "2e302e647464223e3c706c6973742076657273696f6e3d22312e30223e3c646963743e3c6b65793e6e616d653c2f6b65"
+     "793e3c737472696e673e416767726567617465204465766963653c2f737472696e673e3c6b65793e7569643c2f6b6579"
+     "3e3c737472696e673e44696c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b65414141414144696c6c6f"
+     "6e4672616e6b654141414141414141414141414141414132313c2f737472696e673e3c2f646963743e3c2f706c697374"
+     "3e00"},
+    {1010004, 200,
+     "2bef0ab8240000002b35fdbe43f3ae35e318846754690f0025c95c70ccbfd0ab1cceefc6000000002000000000000000"
+     "00000000000000000000000000000000000000000000000000000000000000000000000000000000"},
+    {1010005, 200,
+     "c92842a0380000006a74d49b26f2df381c3660ee55690f000100000000000000000000000102280146010000c36ab80b"
+     "e98e7ff74601000000000000200000000000000000000000000000000000000000000000000000000000000000000000"
+     "0000000000000000000000003c3f786d6c2076657273696f6e3d22312e302220656e636f64696e673d225554462d3822"
+     "3f3e3c21444f435459504520706c697374205055424c494320222d2f2f4170706c652f2f44544420504c49535420312e"
+     "302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d2f445444732f50726f70657274794c6973742d31"
+     "2e302e647464223e3c706c6973742076657273696f6e3d22312e30223e3c646963743e3c6b65793e6e616d653c2f6b65"
+     "793e3c737472696e673e416767726567617465204465766963653c2f737472696e673e3c6b65793e7569643c2f6b6579"
+     "3e3c737472696e673e44696c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b65414141414144696c6c6f"
+     "6e4672616e6b654141414141414141414141414141414132313c2f737472696e673e3c2f646963743e3c2f706c697374"
+     "3e00"},
+    {1010006, 200,
+     "4b5f15c924000000a9b6effce1f0094d4f1d491b56690f00c920d82d830ad6c9867defba000000002000000000000000"
+     "00000000000000000000000000000000000000000000000000000000000000000000000000000000"},
+    {1010007, 200,
+     "a9985dd138000000e8f7c6d984f17840b033ad9257690f0001000000000000000000000000000001ae00000000000000"
+     "000000005700000000000000200000000000000000000000000000000000000000000000000000000000000000000000"
+     "0000000000000000000000002f833c56a63b799576c44d632103ed48501262324ad8a5786438e6eb0e884d73d188f1a2"
+     "b7e0374b774d170159eb16fc37d98a53cf8a8bbe1ba5f6a15af67f290bd1308ec91822b2c5f48390bf08dacfd66f8708"
+     "969d1004f0a33ae68fa8d702ae1f358bb669bfdce3d4911ed049bf426632f87b85620edc9d2cde0bd9ee4f77c1e44df9"
+     "f6ebc6a7c2d5d4bfe6bbac4fbdd4ebae99cc55391dc5b48b6e8add54202eaaa7766e7a920f870a3e78de"},
+    {1010008, 200,
+     "7a8669c94c000000273f91328c3be74e02eaed4c58690f000200000000000000000000000101ad014601000000000000"
+     "0000000000000001a30000000000000000000000a3000000a30000000000000020000000000000000000000000000000"
+     "00000000000000000000000000000000000000000000000000000000000000003c3f786d6c2076657273696f6e3d2231"
+     "2e302220656e636f64696e673d225554462d38223f3e3c21444f435459504520706c697374205055424c494320222d2f"
+     "2f4170706c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d"
+     "2f445444732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076657273696f6e3d22312e3022"
+     "3e3c646963743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567617465204465766963653c2f"
+     "737472696e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b6541414141414469"
+     "6c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b654141414141414141414141414141414132313c2f73"
+     "7472696e673e3c2f646963743e3c2f706c6973743e00c63111b97ef4110bff208041c30c8e990058045018107a8ab7c0"
+     "577571012d97302c84250103f5e63d33c904f4ff70dee11e3c068c15cbc4c3be31c58ee1e8c786594bbba49d506a1c0e"
+     "442c88ef1ab4d53ce2437fcbf42b955a509c27936022f44d7fcb08768eaba2bd2042c8c94a8cdfb27d0f73691fd56622"
+     "ba8f9ca304b6438faa976058fe8dbc6723e1f07f3b7fdf7802005e9221a73e9617b93aa665f520fab9"},
+    {1010009, 200,
+     "984121d138000000667eb817e93a9643fdc409c559690f0001000000000000000000000001028401460100002092f5c2"
+     "5bc5be57a300000000000000200000000000000000000000000000000000000000000000000000000000000000000000"
+     "0000000000000000000000003c3f786d6c2076657273696f6e3d22312e302220656e636f64696e673d225554462d3822"
+     "3f3e3c21444f435459504520706c697374205055424c494320222d2f2f4170706c652f2f44544420504c49535420312e"
+     "302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d2f445444732f50726f70657274794c6973742d31"
+     "2e302e647464223e3c706c6973742076657273696f6e3d22312e30223e3c646963743e3c6b65793e6e616d653c2f6b65"
+     "793e3c737472696e673e416767726567617465204465766963653c2f737472696e673e3c6b65793e7569643c2f6b6579"
+     "3e3c737472696e673e44696c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b65414141414144696c6c6f"
+     "6e4672616e6b654141414141414141414141414141414132313c2f737472696e673e3c2f646963743e3c2f706c697374"
+     "3e00"},
+    {1010010, 200,
+     "1a3676b834000000a5bc83702e384036aeef20305a690f00010000000000000031d7f4a554d211002ad895e431411769"
+     "6593803d0000000020000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "0000000000000000"},
+    {1010011, 200,
+     "f8f13ea034000000e4fdaa554b39313b51c1c4b95b690f000100000000000000ee1b4fbf039d1100cc7b719f1470b835"
+     "952a22e40000000020000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "0000000000000000"},
+    {1010012, 200,
+     "aaeb48d2240000002339b5b6c97ce09f7a8431ab5c690f0070923b3bf1e4994e12600048000000002000000000000000"
+     "00000000000000000000000000000000000000000000000000000000000000000000000000000000"},
+    {1010013, 200,
+     "482c00ca3000000062789c93ac7d919285aad5225d690f009631df40d4d53612e2d9a291483660da9bf279ebb88b6a86"
+     "000000002000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "00000000"},
+    {1010014, 200,
+     "ca5b57a330000000a1baa7f46b7f47e7d681fcd75e690f009c7bbf66be519f2c88d300344a26c67fc19441d760880b11"
+     "000000002000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "00000000"},
+    {1010015, 200,
+     "289c1fbb48000000e0fb8ed10e7e36ea29af185e5f690f000100000000000000000000000102bb01460100007ad85b1d"
+     "9b603070786aa2ed7061746100000000ffffffff46010000000000002000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000003c3f786d6c2076657273696f6e3d22312e302220"
+     "656e636f64696e673d225554462d38223f3e3c21444f435459504520706c697374205055424c494320222d2f2f417070"
+     "6c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d2f445444"
+     "732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076657273696f6e3d22312e30223e3c6469"
+     "63743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567617465204465766963653c2f73747269"
+     "6e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b65414141414144696c6c6f6e"
+     "4672616e6b65414141414144696c6c6f6e4672616e6b654141414141414141414141414141414132313c2f737472696e"
+     "673e3c2f646963743e3c2f706c6973743e00"},
+    {1010016, 200,
+     "3422487a300000001f1b6909f94c2e7008b4cb5a60690f00c871719984cfeeb7646370612a2a2a2a000000002787c49b"
+     "000000002000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "00000000"},
+    {1010017, 200,
+     "d6e50062340000005e5a402c9c4d5f7df79a2fd361690f002ed295e2a1fe41eb589617d96d6f636174706e69ffffffff"
+     "b253e5600000000020000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "0000000000000000"},
+    {1010018, 200,
+     "5492578b480000009d987b4b5b4f8908a4b1062662690f0001000000000000000000000000000001ae00000000000000"
+     "000000000000000070757267626f6c67ffffffff57000000000000002000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000002498f5c4cb7ae8d5329cb57ce883b01be760e223"
+     "c79853f134903db732ea978af9aa37ed989552f0fd1c48a4f9480410f4c76e58e88b3224785604e0ffe6090f698b5654"
+     "f007e3a44d9f68d2c5f2fde835495533d5e4f94404363ce8d7f88bee999af5e20be9961537037b9dee0d17d166d42b69"
+     "51e77c16423e48e0ad161a821fdb5600d69d04a8bd76a4b1b25381068ab59ecd60be27c5fc4f9d30b0cbc843ab0c3c8e"
+     "0727eb465ae67b1d7977"},
+    {1010019, 200,
+     "b6551f1330000000dcd9526e3e4ef8055b9fe2af63690f00c23b11bfee4b478974736d61626f6c67ffffffffff84a50c"
+     "000000002000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "00000000"},
+    {1010020, 200,
+     "e44f69e1480000001b1d4d8dbc0b29a170da17bd64690f0001000000000000000000000000000001ae00000000000000"
+     "000000000000000070757267626f6c67ffffffff2b000000000000002000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000007ed25b1b0bdf66f2456f350961a9f8fd26aca7a4"
+     "bf00226a50eacfe69fa0bde22d153b293d1b676bcf9e21d564d4d74a3090776f4545d93042fcef3e60502472b45795fc"
+     "3569f7feb552cc9f1048d8493501f982a1288a8928682c8ab57adadfded9fce7fad18a7553dddc356d6dd9b2675d9782"
+     "d5ded9b443e51232ec5589b63f4935fb2682216dd5d6476351e39c4925470d893a3e18a4a76afaaf32421c7468e8fb12"
+     "e4592945e5461e4e1a48"},
+    {1010021, 200,
+     "068821f9300000005a5c64a8d90a58ac8ff4f33465690f009871bf602eeec9ae74736d6174706e6900000000871cd497"
+     "000000002000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "00000000"},
+    {1010022, 200,
+     "84ff769034000000999e5fcf1e088ed9dcdfdac166690f00923bdf46446a6090dfdc35757061746174706e69ffffffff"
+     "84911c1a0000000020000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "0000000000000000"},
+    {1010023, 200,
+     "66383e8830000000d8df76ea7b09ffd423f13e4867690f0074983b3d615bcfcc74736d612a2a2a2a00000000670343fd"
+     "000000002000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "00000000"},
+    {1010024, 200,
+     "b5260a10340000001717210173c360da91287e9668690f009d2a16d2b994a752a6815a8e7061746175727470ffffffff"
+     "05d1a6af0000000020000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "0000000000000000"},
+    {1010025, 200,
+     "57e14208300000005656082416c211d76e069a1f69690f007b89f2a99ca5080e00000000626f6c67000000000dd76af2"
+     "000000002000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "00000000"},
+    {1010026, 200,
+     "d59615613000000095943343d1c0c7a23d2db3ea6a690f0071c3928ff621a130707572672a2a2a2affffffffd5d40b65"
+     "000000002000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "00000000"},
+    {1010027, 200,
+     "37515d7930000000d4d51a66b4c1b6afc20357636b690f00976076f4d3100e6c2a2a2a2a74706e6900000000edc8fd98"
+     "000000002000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "00000000"},
+    {1010028, 200,
+     "654b2b8b30000000131105853684670be946a2716c690f002b893c5036842f177072676174706e6900000000ad4c7afe"
+     "000000002000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "00000000"},
+    {1010029, 200,
+     "878c63935c00000052502ca053851606166846f86d690f00020000000000000000000000010404014601000000000000"
+     "0000000000000001a30000000000000000000000000000000000000070757267626f6c6746010000a300000000000000"
+     "200000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "3c3f786d6c2076657273696f6e3d22312e302220656e636f64696e673d225554462d38223f3e3c21444f435459504520"
+     "706c697374205055424c494320222d2f2f4170706c652f2f44544420504c49535420312e302f2f454e22202268747470"
+     "3a2f2f7777772e6170706c652e636f6d2f445444732f50726f70657274794c6973742d312e302e647464223e3c706c69"
+     "73742076657273696f6e3d22312e30223e3c646963743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e4167"
+     "67726567617465204465766963653c2f737472696e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c"
+     "6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b654141414141"
+     "414141414141414141414132313c2f737472696e673e3c2f646963743e3c2f706c6973743e00cd2ad82b13b5804bbb78"
+     "785e0a8cd3cab72a844195508c03e7688c294d63f76e180e426a2e76905db76296a1545c62322200d80dab14725ea04d"
+     "c3842bf19ee1e4032d619d82917c9465af6ef2153d93361a30783cb21d6b61cf56927fc33ccec3c8bfa2b5f6a762766a"
+     "cac1f68de21fdf54ae1da7ec6d1fb9302c64e85b51439db0b16e402e3c82c3c453efa4971636e8197763a7e0535bdf1c"
+     "3e02e4e770e2abd82f"},
+    {1010030, 200,
+     "05fb34fa34000000919217c79487c07345436f0d6e690f00c760b80d79312975d172dafb646370617074756f00000000"
+     "61ab54fe0000000020000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "0000000000000000"},
+    {1010031, 200,
+     "e73c7ce234000000d0d33ee2f186b17eba6d8b846f690f0021c35c765c00862921cb78222a2a2a2a74706e69ffffffff"
+     "33135fd50000000020000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "0000000000000000"},
+    {1010032, 200,
+     "a7002672380000000f03f918ac1b93045ecabfec70690f00198d940bb554a8e5f2b1d4b1ace1a48964637061626f6c67"
+     "00000000ad20ea6100000000200000000000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000"},
+    {1010033, 200,
+     "45c76eea480000004e42d03dc91ae209a1e45b6571690f000100000000000000000000000100b80146010000ff2e7070"
+     "906507b902087668000000000000000000000000a3000000000000002000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000003c3f786d6c2076657273696f6e3d22312e302220"
+     "656e636f64696e673d225554462d38223f3e3c21444f435459504520706c697374205055424c494320222d2f2f417070"
+     "6c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d2f445444"
+     "732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076657273696f6e3d22312e30223e3c6469"
+     "63743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567617465204465766963653c2f73747269"
+     "6e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b65414141414144696c6c6f6e"
+     "4672616e6b65414141414144696c6c6f6e4672616e6b654141414141414141414141414141414132313c2f737472696e"
+     "673e3c2f646963743e3c2f706c6973743e00"},
+    {1010034, 200,
+     "c7b03983480000008d80eb5a0e18347cf2cf729072690f0001000000000000000000000000000001ae00000000000000"
+     "000000000000000070757267626f6c67ffffffffae000000000000002000000000000000000000000000000000000000"
+     "00000000000000000000000000000000000000000000000000000000f5641056fae1ae876802d4cdd46d6b9b52ac05ab"
+     "262c6822181060403c6414b41563317347871602b87145b37caab9662420c0017f2dab167cd411a510949570aa893ab2"
+     "f126c64f352339dd624e84810436f40fb5300ac22d654db534547248aef776b07989b28350121c3236d2b5a84973bfd8"
+     "23d9ce05bf320c1ed685f2c3107afabb3216e2dda0814ef63f75fd0856cc735fbf54301ac891de53239b52daeb707802"
+     "ea8b66eaed4e6e06e267"},
+    {1010035, 200,
+     "2577711b30000000ccc1c27f6b1945710de1961973690f0013c7f42ddfd001db98bb7614aef1022c38a011af1e309edf"
+     "000000002000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "00000000"},
+    {1010036, 200,
+     "776d07e9300000000b05dd9ce95c94d526a4630b74690f00af2ebe893a4420a01ff154b85d47237d9360402c5eb419b9"
+     "000000002000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "00000000"},
+    {1010037, 200,
+     "95aa4ff14c0000004a44f4b98c5de5d8d98a878275690f000200000000000000559b62dc26f611000000000000000000"
+     "0101dd0146010000498d5af21f758ffcef48f66127db4acaa30000000000000020000000000000000000000000000000"
+     "00000000000000000000000000000000000000000000000000000000000000003c3f786d6c2076657273696f6e3d2231"
+     "2e302220656e636f64696e673d225554462d38223f3e3c21444f435459504520706c697374205055424c494320222d2f"
+     "2f4170706c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d"
+     "2f445444732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076657273696f6e3d22312e3022"
+     "3e3c646963743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567617465204465766963653c2f"
+     "737472696e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b6541414141414469"
+     "6c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b654141414141414141414141414141414132313c2f73"
+     "7472696e673e3c2f646963743e3c2f706c6973743e00"},
+    {1010038, 200,
+     "17dd18983c0000008986cfde4b5f33ad8aa1ae7776690f000100000000000000000000000100ae014601000043c73ad4"
+     "75f126c2854254c446010000000000002000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000000000003c3f786d6c2076657273696f6e3d22312e302220656e636f64696e673d225554"
+     "462d38223f3e3c21444f435459504520706c697374205055424c494320222d2f2f4170706c652f2f44544420504c4953"
+     "5420312e302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d2f445444732f50726f70657274794c69"
+     "73742d312e302e647464223e3c706c6973742076657273696f6e3d22312e30223e3c646963743e3c6b65793e6e616d65"
+     "3c2f6b65793e3c737472696e673e416767726567617465204465766963653c2f737472696e673e3c6b65793e7569643c"
+     "2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b65414141414144"
+     "696c6c6f6e4672616e6b654141414141414141414141414141414132313c2f737472696e673e3c2f646963743e3c2f70"
+     "6c6973743e00"},
+    {1010039, 200,
+     "f51a508028000000c8c7e6fb2e5e42a0758f4afe77690f00a564deaf50c0899e75fbf61d5f5785d80000000020000000"
+     "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"},
+    {1010040, 200,
+     "2604649848000000070fb1102694ddaec7560a2078690f0001000000000000000000000000000001ae00000000000000"
+     "000000000000000070757267626f6c67ffffffffae000000000000002000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000004cd6f340880fe100fc1f3b3fbd58e609994c1e72"
+     "d47fa7dc2951fb5844ba0b6fb76078b02f970e8451170d4fbfc0b9a63b59398b3cdcf1b05f19c1d2c16e801f0d3719d5"
+     "ca7dd7484492a76230ae9f6efa273be942e00543b71e98516fdda6af72f0ebe2a7d015739f063cd84d55af245e1ae80f"
+     "790727db3e48d887084880d5045c2ce411e9c6bb301cd03b495959178b582a9463d992f350f0e9c2457ba9624e9ef9b0"
+     "652bd516ca5befb0bff4"},
+    {1010041, 200,
+     "c4c32c8048000000464e98354395aca33878eea979690f0001000000000000000000000000000001ae00000000000000"
+     "000000000000000070757267626f6c67ffffffff57000000000000002000000000000000000000000000000000000000"
+     "00000000000000000000000000000000000000000000000000000000aa75173bad3e4e5c0ca699e6c7c48fbef3400a76"
+     "ec6351217be9f0737fe3a0ed72622a36d44dbd4e5cd6d94ce2d552fc536b71f5ecfd8a03adf4d1f2571103c548faf3aa"
+     "777d71351b05bdf479adc49ba63f6deb5e669a8b22801921834eaa774b270b55bd7ea40781c42bb7a23bfb3aaa3fdba0"
+     "9baca31a6ea2a71e42301836a2b7583428382e48f077ff24dcb7f21f270fa16ae413e3907b6fdbc2a1a0a3409a5f4dcb"
+     "bcbbac31555369c3e4dd"},
+    {1010042, 200,
+     "46b47be948000000858ca35284977ad66b53c75c7a690f000100000000000000000000000100020146010000a03f771d"
+     "c7bae76266ac3b4300000000626f6c67ffffffff46010000000000002000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000003c3f786d6c2076657273696f6e3d22312e302220"
+     "656e636f64696e673d225554462d38223f3e3c21444f435459504520706c697374205055424c494320222d2f2f417070"
+     "6c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d2f445444"
+     "732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076657273696f6e3d22312e30223e3c6469"
+     "63743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567617465204465766963653c2f73747269"
+     "6e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b65414141414144696c6c6f6e"
+     "4672616e6b65414141414144696c6c6f6e4672616e6b654141414141414141414141414141414132313c2f737472696e"
+     "673e3c2f646963743e3c2f706c6973743e00"},
+    {1010043, 200,
+     "a47333f148000000c4cd8a77e1960bdb947d23d57b690f0001000000000000000000000001002b0146010000469c9366"
+     "e28b483e9615999a6d6f636174706e69ffffffff46010000000000002000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000003c3f786d6c2076657273696f6e3d22312e302220"
+     "656e636f64696e673d225554462d38223f3e3c21444f435459504520706c697374205055424c494320222d2f2f417070"
+     "6c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d2f445444"
+     "732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076657273696f6e3d22312e30223e3c6469"
+     "63743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567617465204465766963653c2f73747269"
+     "6e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b65414141414144696c6c6f6e"
+     "4672616e6b65414141414144696c6c6f6e4672616e6b654141414141414141414141414141414132313c2f737472696e"
+     "673e3c2f646963743e3c2f706c6973743e00"},
+    {1010044, 200,
+     "f6694583480000000309959463d3da7fbf38d6c77c690f0001000000000000000000000001003d0146010000fa75d9c2"
+     "071f6945115fbb3600000000626f6c6700000000a3000000000000002000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000003c3f786d6c2076657273696f6e3d22312e302220"
+     "656e636f64696e673d225554462d38223f3e3c21444f435459504520706c697374205055424c494320222d2f2f417070"
+     "6c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d2f445444"
+     "732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076657273696f6e3d22312e30223e3c6469"
+     "63743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567617465204465766963653c2f73747269"
+     "6e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b65414141414144696c6c6f6e"
+     "4672616e6b65414141414144696c6c6f6e4672616e6b654141414141414141414141414141414132313c2f737472696e"
+     "673e3c2f646963743e3c2f706c6973743e00"},
+    {1010045, 200,
+     "14ae0d9b480000004248bcb106d2ab724016324e7d690f0001000000000000000000000001001401460100001cd63db9"
+     "222ec619e1e619ef2a2a2a2a000000000000000046010000000000002000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000003c3f786d6c2076657273696f6e3d22312e302220"
+     "656e636f64696e673d225554462d38223f3e3c21444f435459504520706c697374205055424c494320222d2f2f417070"
+     "6c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d2f445444"
+     "732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076657273696f6e3d22312e30223e3c6469"
+     "63743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567617465204465766963653c2f73747269"
+     "6e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b65414141414144696c6c6f6e"
+     "4672616e6b65414141414144696c6c6f6e4672616e6b654141414141414141414141414141414132313c2f737472696e"
+     "673e3c2f646963743e3c2f706c6973743e00"},
+    {1010046, 200,
+     "96d95af248000000818a87d6c1d07d07133d1bbb7e690f0001000000000000000000000000000001ae00000000000000"
+     "000000000000000070757267626f6c67ffffffff2b000000000000002000000000000000000000000000000000000000"
+     "00000000000000000000000000000000000000000000000000000000169c5d9f48aa6f278becbb4a3472aeef58805bf5"
+     "ace7d6474d2b0909e9f0210763df74748a193b1f6395643e225c6afcff0e20bc91121aa465b32a0c5ed8ad62d0ebda7d"
+     "0f13c312bc5f032fe514bacffa6f9758362c768e9b4088330d5ff79e35b3e2e756e80913fbd89b70ce3561475f9354e4"
+     "fd3e82793f938255490b13e124ce4f1fe1f6e37e58bc33e9aae9445824aab9d03959ad920bd58e5dc7f27d558d7a3e2c"
+     "8655171575fb8ae3dccb"},
+    {1010047, 200,
+     "741e12ea5c000000c0cbaef3a4d10c0aec13ff327f690f0002000000000000000000000000000001ae00000000000000"
+     "0000000000000001460100000000000000000000000000000000000070757267626f6c67ae000000a300000000000000"
+     "200000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "f03fb9e46d9bc07b7b5519934eeec758328c4ff194fb20ba1f930222d2a98a85a6dd26f271c388d56e54b03d7f4981a6"
+     "973c68c241336117975e3a2cc8a72eb895263002b213656fe3c819b9ac17e13aa677c15a2aaae9460ede0943e1ccfb46"
+     "0c6402504c46b867e51a8c1f215b3559abb6674b1f9506b86f79fdcc03738b0282253bcfd8270b8d98d71cf63f07ef50"
+     "88fd322ebe93dcf1204abc5d2329777759bb8a575fc56e32eaf30c9087e23c3f786d6c2076657273696f6e3d22312e30"
+     "2220656e636f64696e673d225554462d38223f3e3c21444f435459504520706c697374205055424c494320222d2f2f41"
+     "70706c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d2f44"
+     "5444732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076657273696f6e3d22312e30223e3c"
+     "646963743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567617465204465766963653c2f7374"
+     "72696e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b65414141414144696c6c"
+     "6f6e4672616e6b65414141414144696c6c6f6e4672616e6b654141414141414141414141414141414132313c2f737472"
+     "696e673e3c2f646963743e3c2f706c6973743e00"},
+    {1010048, 200,
+     "15372bd15c000000fecb80cfa62dabce431f3de980690f0002000000000000000000000000000001ae00000000000000"
+     "0000000000000001460100000000000000000000000000000000000070757267626f6c6757000000a300000000000000"
+     "200000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "08fc5bede2fb449a43256f7b3b3da7848962668ebbbe4f993e101ef0b3a0a9ac57c16e9271a736e26bcb287a442c3c3e"
+     "d8f7aacbd473332f0579230fc1de2949e39ab548e4f706e8a9747ed4111b5f8760a2a56a92ffec9bf46b9dd6b1b60365"
+     "15a3e2d556bca9f22fbd0cdebf8621f776ac75479376e88524f645f13e90cb6c52bc8d4204aa53b7ba0931a5a69dea6d"
+     "6f0551d72e16d0fb6c3ee0ab86f122dcc186fbca17c17e9cd108de9d48803c3f786d6c2076657273696f6e3d22312e30"
+     "2220656e636f64696e673d225554462d38223f3e3c21444f435459504520706c697374205055424c494320222d2f2f41"
+     "70706c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d2f44"
+     "5444732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076657273696f6e3d22312e30223e3c"
+     "646963743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567617465204465766963653c2f7374"
+     "72696e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b65414141414144696c6c"
+     "6f6e4672616e6b65414141414144696c6c6f6e4672616e6b654141414141414141414141414141414132313c2f737472"
+     "696e673e3c2f646963743e3c2f706c6973743e00"},
+    {1010049, 200,
+     "f7f063c95c000000bf8aa9eac32cdac3bc31d96081690f0002000000000000000000000000000001ae00000000000000"
+     "0000000000000001460100000000000000000000000000000000000070757267626f6c67ae000000a300000000000000"
+     "200000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "ee5fbf96c7caebc6b39ccda241a1ce33e36e728a83a2b9646ca815db88f9022e92c33c148a7d8528660afc791939d764"
+     "b0c5e2b50452489cf794332f57a1aa93a6575f3759f7a095f6e36442581804723cbaf3688e79735361f51ca65d250fbd"
+     "2c7402624c121886317f1bb150e875e9828946e871dd6c44741c3a6874e8538ff457f9923d7bbb447a621eba33734165"
+     "c352da29a9dca19847a1d2ab622a28fe15474fb1ce5107bb4e0058ee13a93c3f786d6c2076657273696f6e3d22312e30"
+     "2220656e636f64696e673d225554462d38223f3e3c21444f435459504520706c697374205055424c494320222d2f2f41"
+     "70706c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d2f44"
+     "5444732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076657273696f6e3d22312e30223e3c"
+     "646963743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567617465204465766963653c2f7374"
+     "72696e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b65414141414144696c6c"
+     "6f6e4672616e6b65414141414144696c6c6f6e4672616e6b654141414141414141414141414141414132313c2f737472"
+     "696e673e3c2f646963743e3c2f706c6973743e00"},
+    {1010050, 200,
+     "758734a05c0000007c48928d042e0cb6ef1af09582690f00020000000000000000000000010176014601000000000000"
+     "0000000000000001a30000000000000000000000000000000000000070757267626f6c67460100005100000000000000"
+     "200000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "3c3f786d6c2076657273696f6e3d22312e302220656e636f64696e673d225554462d38223f3e3c21444f435459504520"
+     "706c697374205055424c494320222d2f2f4170706c652f2f44544420504c49535420312e302f2f454e22202268747470"
+     "3a2f2f7777772e6170706c652e636f6d2f445444732f50726f70657274794c6973742d312e302e647464223e3c706c69"
+     "73742076657273696f6e3d22312e30223e3c646963743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e4167"
+     "67726567617465204465766963653c2f737472696e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c"
+     "6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b654141414141"
+     "414141414141414141414132313c2f737472696e673e3c2f646963743e3c2f706c6973743e00e415dfb0ad4e42f8d996"
+     "6f0743b16896b9084ab65ba1d8f3ea6bcd0c22e4577905db0c94f1006a98f79003f1eadb62dcbd2cb45da9f2b95436e8"
+     "cfe2cdfa056f51bdc4cdca47d710a665990ce8a5fa47c1b0f574e433eb30b229b35acc153d4bed62dc75dd6c9261dbdc"
+     "2dafb08f54c82de928a0593131310fb3d0a7ae2bf96c4288ab58782882cdfced94fbb02b6f05d398f908e88f488ea7b6"
+     "2197d26fbfd073991a"},
+    {1010051, 200,
+     "97407cb85c0000003d09bba8612f7dbb1034141c83690f0002000000000000000000000001015f014601000000000000"
+     "0000000000000001a30000000000000000000000000000000000000070757267626f6c67a3000000a300000000000000"
+     "200000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "3c3f786d6c2076657273696f6e3d22312e302220656e636f64696e673d225554462d38223f3e3c21444f435459504520"
+     "706c697374205055424c494320222d2f2f4170706c652f2f44544420504c49535420312e302f2f454e22202268747470"
+     "3a2f2f7777772e6170706c652e636f6d2f445444732f50726f70657274794c6973742d312e302e647464223e3c706c69"
+     "73742076657273696f6e3d22312e30223e3c646963743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e4167"
+     "67726567617465204465766963653c2f737472696e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c"
+     "6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b654141414141"
+     "414141414141414141414132313c2f737472696e673e3c2f646963743e3c2f706c6973743e0002b63bcb887feda4292f"
+     "cdde392d0121d3045eb263bd2e0eb8d3c62719bdfcfbc0d95e120adad952fa51d7f2b7ce8986d51efc2379d3c2e7c405"
+     "dfc25b8586b514702eb27747716df9f2839aa1a6a1b29da8a376f8b574f827b7322a20863193d4b53cc2c7c22315c51e"
+     "3ac05fe100d6d9cc1b0fbb9ab5f05f59af3ee453618fe463df8841f96a3e3c86bbe425c5c40d7fcf72f66f4539ed8c29"
+     "139736b4b5f2a758ae"},
+    {1010052, 200,
+     "c55a0aca5c000000facda44be36aac1f3b71e10e84690f00020000000000000000000000010249014601000000000000"
+     "000000000100b00177000000930e688a75ef686a58621ac8a38837a723706174626f6c67460100003b00000000000000"
+     "200000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "3c3f786d6c2076657273696f6e3d22312e302220656e636f64696e673d225554462d38223f3e3c21444f435459504520"
+     "706c697374205055424c494320222d2f2f4170706c652f2f44544420504c49535420312e302f2f454e22202268747470"
+     "3a2f2f7777772e6170706c652e636f6d2f445444732f50726f70657274794c6973742d312e302e647464223e3c706c69"
+     "73742076657273696f6e3d22312e30223e3c646963743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e4167"
+     "67726567617465204465766963653c2f737472696e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c"
+     "6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b654141414141"
+     "414141414141414141414132313c2f737472696e673e3c2f646963743e3c2f706c6973743e00be5f716f6debccdfae65"
+     "ef72ca9b207078c40f312339a9688e113f5d8fae7d11d1640050548e5f03c5126a807747b186797bad6a043c52400c42"
+     "243c524c28128c6107650f29c34a5ea83d413d1fdfe6c1f859c590ff98fd9e77a338ae976c7aaa21d5702c548e01bf02"
+     "8a0733ef9aab2c60944bdd0894"},
+    {1010053, 200,
+     "279d42d254000000bb8c8d6e866bdd12c45f058785690f000200000000000000c865153fe2fb11000000000000000000"
+     "00000001a700000000000000000000000000000000000000000000000000000000000000000000002000000000000000"
+     "0000000000000000000000000000000000000000000000000000000000000000000000000000000058fc951448da6383"
+     "5edc4dabb00749c712c81b351b255f95dca93476b4f7d693146652d6af54ecc9c8d3be832a525adc1149e514d41d29f3"
+     "feaf341cc433abc8c9aced1ab2296537013f27d7741c84139de00fc78c7907350be92248420460a293f635c736fa3f75"
+     "a1c09d68dc81ceb5d845a7e43fa310525e82f5eca510f2bbc4f1bc73b1e64ffb54265836c675d942d03de1b235c5068c"
+     "d70c7408b43d61c564bc690d59c3bc"},
+    {1010054, 200,
+     "a5ea15bb3c000000784eb60941690b6797742c7286690f000100000000000000cb1a62960690110052b6f532225ecabd"
+     "34d6ef0eb217ef6248ae2309000000002000000000000000000000000000000000000000000000000000000000000000"
+     "00000000000000000000000000000000"},
+    {1010055, 200,
+     "472d5d2330000000390f9f2c24687a6a685ac8fb87690f00b4151149076f65e17072676175727470fffffffffb3ac8ff"
+     "000000002000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "00000000"},
+    {1010056, 200,
+     "943369bb48000000f6c7c8c72ca2e564da83882588690f000100000000000000000000000101e501460100005da73ca6"
+     "dfa00d7f4d8b80f56d6f63612a2a2a2a0000000028000000000000002000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000003c3f786d6c2076657273696f6e3d22312e302220"
+     "656e636f64696e673d225554462d38223f3e3c21444f435459504520706c697374205055424c494320222d2f2f417070"
+     "6c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d2f445444"
+     "732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076657273696f6e3d22312e30223e3c6469"
+     "63743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567617465204465766963653c2f73747269"
+     "6e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b65414141414144696c6c6f6e"
+     "4672616e6b65414141414144696c6c6f6e4672616e6b654141414141414141414141414141414132313c2f737472696e"
+     "673e3c2f646963743e3c2f706c6973743e00"},
+    {1010057, 200,
+     "76f421a348000000b786e1e249a3946925ad6cac89690f000100000000000000000000000101cc0146010000bb04d8dd"
+     "fa91a223bd32222c00000000000000000000000028000000000000002000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000003c3f786d6c2076657273696f6e3d22312e302220"
+     "656e636f64696e673d225554462d38223f3e3c21444f435459504520706c697374205055424c494320222d2f2f417070"
+     "6c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d2f445444"
+     "732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076657273696f6e3d22312e30223e3c6469"
+     "63743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567617465204465766963653c2f73747269"
+     "6e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b65414141414144696c6c6f6e"
+     "4672616e6b65414141414144696c6c6f6e4672616e6b654141414141414141414141414141414132313c2f737472696e"
+     "673e3c2f646963743e3c2f706c6973743e00"},
+    {1010058, 200,
+     "f48376ca340000007444da858ea1421c768645598a690f00010000000000000064c6679d63a11100b14eb8fb90150b1d"
+     "d73880890000000020000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "0000000000000000"},
+    {1010059, 200,
+     "16443ed2240000003505f3a0eba0331189a8a1d08b690f0057ed5c80b524a44127812250000000002000000000000000"
+     "00000000000000000000000000000000000000000000000000000000000000000000000000000000"},
+    {1010060, 200,
+     "445e48a058000000f2c1ec4369e5e2b5a2ed54c28c690f000200000000000000c7aa5bcf096d11000000000000000000"
+     "00000001a700000000000000000000000000000000000000000000000000000053000000000000000000000020000000"
+     "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000eb041624"
+     "50b0853aa0cb00fcdb2262f0834e38d03175f1fc6b2b77b966349c1f217d2b95bc391bffb02f09f71adaefa403d94a76"
+     "3a4c829d1c1e18a68f92115b99f855871ac203b520084426964161c99efbc63d11e390d7424e585088bd86b38ee77682"
+     "79dd126284778b9c4761f518604c9e7b4d91a4f9a457cbbaa11e2a4e660838e6d74a521442344cba3301533d1d639b58"
+     "a81b4d73af7ab0a562980d53a78cbde47b1f0f"},
+    {1010061, 200,
+     "a69900b858000000b380c5660ce493b85dc3b04b8d690f0002000000000000001866e0d55e2211000000000000000000"
+     "00000001a700000000000000000000000000000000000000000000000000000053000000000000000000000020000000"
+     "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000da7f25f"
+     "75812a665072a225a1be0b47e9422cd40969070139937c925d6d379de47f791347e3a835bdeeddf447cf04fe6beb0208"
+     "ea6df92eeef3088619ed9281dc35bff8a7c2a5c87f9f5eb0df423a3cc2e3903f0d650f1fd7d0d920642e8a6bb7309635"
+     "6373a3169ab59cf3a80fa1069469add4af3a2038f4bdb423eb66b2adc0e34c36ee9bbae7825f63a5a6eff835b13410a6"
+     "2fd13c1084e582a586430771734d099fa28f76"},
+    {1010062, 200,
+     "24ee57d1580000007042fe01cbe645cd0ee899be8e690f0002000000000000001b19977cba4911000000000000000000"
+     "010176014601000007ed92791f0583583a780080a3aeade2b32414e8d16a6696a3000000f77062ca0000000020000000"
+     "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000003c3f786d"
+     "6c2076657273696f6e3d22312e302220656e636f64696e673d225554462d38223f3e3c21444f435459504520706c6973"
+     "74205055424c494320222d2f2f4170706c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f77"
+     "77772e6170706c652e636f6d2f445444732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076"
+     "657273696f6e3d22312e30223e3c646963743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567"
+     "617465204465766963653c2f737472696e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e46"
+     "72616e6b65414141414144696c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b65414141414141414141"
+     "4141414141414132313c2f737472696e673e3c2f646963743e3c2f706c6973743e00"},
+    {1010063, 200,
+     "c6291fc9340000003103d724aee734c0f1c67d378f690f000100000000000000c4d52c66ed061100e14e76023a342c04"
+     "cac1a2590000000020000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "0000000000000000"},
+    {1010064, 200,
+     "861545d93c000000eed310def37a16ba1561495f90690f00010000000000000035f9d2ab26f01100d900be7fd36002c8"
+     "19bb0eca07d37c043cae8106000000002000000000000000000000000000000000000000000000000000000000000000"
+     "00000000000000000000000000000000"},
+    {1010065, 200,
+     "64d20dc134000000af9239fb967b67b7ea4fadd691690f000100000000000000ea3569b171bf11003fa35a04f651ad94"
+     "e902ac130000000020000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "0000000000000000"},
+    {1010066, 200,
+     "e6a55aa8580000006c50029c5179b1c2b964842392690f000200000000000000e94a1e1895d411000000000000000000"
+     "00000001a700000000000000000000000000000000000000000000000000000053000000000000000000000020000000"
+     "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000035e93a22"
+     "9cd504aa83080eb67f5fb3160cc4ad3eba15e320c6eb90fb2c6ad447e9120a0a2e122e6ab2fd0ee66f39dfaa6dcb1a04"
+     "3e542066326adaa72288991092bfa82bcb66f2fbded9c8034f19832ef0cf544884e718b69b7ac2072fb9c4edda0f5f27"
+     "af0cb6f7bccd4a006850f6b1024ebc112b0f8322f2bf9459d5b8112d4d2907e39ca364b8e11a7ebc3d0d130b0fe1149a"
+     "37655f51936862f4413f254933e55e668e818a"},
+    {1010067, 200,
+     "046212b0240000002d112bb93478c0cf464a60aa93690f00d34ade59b9e4abf673b1ac6f000000002000000000000000"
+     "00000000000000000000000000000000000000000000000000000000000000000000000000000000"},
+    {1010068, 200,
+     "5678644224000000ead5345ab63d116b6d0f95b894690f006fa394fd5c708a8df4fb8ec3000000002000000000000000"
+     "00000000000000000000000000000000000000000000000000000000000000000000000000000000"},
+    {1010069, 200,
+     "b4bf2cda4c000000ab941d7fd33c60669221713195690f00030000000000000095ea9950a857110000000000709c551b"
+     "8d54110000000000319584f5b46f180089007086794125d104422c1a0000000020000000000000000000000000000000"
+     "0000000000000000000000000000000000000000000000000000000000000000"},
+    {1010070, 200,
+     "36c87bb35400000068562618143eb613c10a58c496690f0003000000000000009695eef94c3c110000000000af8205ad"
+     "d5b01100000000003133d90019131100834a10a013c58cef6e488ebf8ef934e2fd62c481000000002000000000000000"
+     "00000000000000000000000000000000000000000000000000000000000000000000000000000000"},
+    {1010071, 200,
+     "d40f33ab5800000029170f3d713fc71e3e24bc4d97690f000200000000000000495955e31b7311000000000000000000"
+     "00000001a700000000000000000000000000000000000000000000000000000053000000000000000000000020000000"
+     "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000065e9f4db"
+     "36f423b39ef12c66f4655d55976ed0851a8ef32c2452ba7d2b3dab78aab5364ef0e1f44111e5981f0147b948a47555db"
+     "3e3a3abac9bccdb427651b91b889f0799db89124769291002a1e58ba0d8dfee59a61f31864f87d99dc0ba72a5c5a8835"
+     "cf4a207032b0dbb60b5719f3aca76eb287da7bf588cb24444e3828fadb6436d229ef78f40f35172f5de52024b0d9a4ff"
+     "2cb68926285af65773f3665096dfcca1c08348"},
+    {1010072, 200,
+     "071107b35e000000e6df58d679f558108cfdfc9398690f008c5bd934ee3b4b2d1715e144166a3e84c724b6e748462cde"
+     "f7aa0be354b4cb9c4b1143c9460236ec5b9b461aac53df6a72b2e38e7da57ac011a70ad0f3728c7f35018b4cf03d0000"
+     "000020000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "0000"},
+    {1, 200,
+     "1ea28bfc61000000ec371f518978bee774a0f18a010000001b3dfb849d44e0459d56b807c7787a88477123f162f01baf"
+     "a4b1b80b659b122e7ed05ff34236ec132bd3c425fb6c449c8bfa5f3ba3c4c5b25b234d89a46303b9ca81b44f572f475b"
+     "a50000000020000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "0000000000"},
+    {1010000, 20,
+     "43af58ee380000002f33d93a06b4a9e49b76588050690f000100000000000000936a76f2000011000000000000000000"
+     "000000000000000000000000200000000000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000"},
+    {1010001, 20,
+     "669ef7b2180000006e72f01f63b5d8e96458bc0951690f00000000002000000000000000000000000000000000000000"
+     "00000000000000000000000000000000000000000000000000000000"},
+    {1010002, 20,
+     "0c1a5e8c24000000adb0cb78a4b70e9c377395fc52690f007f83f2af0000000000000000000000002000000000000000"
+     "00000000000000000000000000000000000000000000000000000000000000000000000000000000"},
+    {1010003, 20,
+     "292bf1d038000000ecf1e25dc1b67f91c85d717553690f00010000000000000000000000000000014601000000000000"
+     "000000004601000000000000200000000000000000000000000000000000000000000000000000000000000000000000"
+     "0000000000000000000000003c3f786d6c2076657273696f6e3d22312e302220656e636f64696e673d225554462d3822"
+     "3f3e3c21444f435459504520706c697374205055424c494320222d2f2f4170706c652f2f44544420504c49535420312e"
+     "302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d2f445444732f50726f70657274794c6973742d31"
+     "2e302e647464223e3c706c6973742076657273696f6e3d22312e30223e3c646963743e3c6b65793e6e616d653c2f6b65"
+     "793e3c737472696e673e416767726567617465204465766963653c2f737472696e673e3c6b65793e7569643c2f6b6579"
+     "3e3c737472696e673e44696c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b65414141414144696c6c6f"
+     "6e4672616e6b654141414141414141414141414141414132313c2f737472696e673e3c2f646963743e3c2f706c697374"
+     "3e00"},
+    {1010004, 20,
+     "ccbfd0ab240000002b35fdbe43f3ae35e318846754690f0025c95c700000000000000000000000002000000000000000"
+     "00000000000000000000000000000000000000000000000000000000000000000000000000000000"},
+    {1010005, 20,
+     "e98e7ff7380000006a74d49b26f2df381c3660ee55690f00010000000000000000000000000000014601000000000000"
+     "000000004601000000000000200000000000000000000000000000000000000000000000000000000000000000000000"
+     "0000000000000000000000003c3f786d6c2076657273696f6e3d22312e302220656e636f64696e673d225554462d3822"
+     "3f3e3c21444f435459504520706c697374205055424c494320222d2f2f4170706c652f2f44544420504c49535420312e"
+     "302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d2f445444732f50726f70657274794c6973742d31"
+     "2e302e647464223e3c706c6973742076657273696f6e3d22312e30223e3c646963743e3c6b65793e6e616d653c2f6b65"
+     "793e3c737472696e673e416767726567617465204465766963653c2f737472696e673e3c6b65793e7569643c2f6b6579"
+     "3e3c737472696e673e44696c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b65414141414144696c6c6f"
+     "6e4672616e6b654141414141414141414141414141414132313c2f737472696e673e3c2f646963743e3c2f706c697374"
+     "3e00"},
+    {1010006, 20,
+     "830ad6c924000000a9b6effce1f0094d4f1d491b56690f00c920d82d0000000000000000000000002000000000000000"
+     "00000000000000000000000000000000000000000000000000000000000000000000000000000000"},
+    {1010007, 20,
+     "a63b799538000000e8f7c6d984f17840b033ad9257690f00010000000000000000000000000000014601000000000000"
+     "00000000a300000000000000200000000000000000000000000000000000000000000000000000000000000000000000"
+     "0000000000000000000000003c3f786d6c2076657273696f6e3d22312e302220656e636f64696e673d225554462d3822"
+     "3f3e3c21444f435459504520706c697374205055424c494320222d2f2f4170706c652f2f44544420504c49535420312e"
+     "302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d2f445444732f50726f70657274794c6973742d31"
+     "2e302e647464223e3c706c6973742076657273696f6e3d22312e30223e3c646963743e3c6b65793e6e616d653c2f6b65"
+     "793e3c737472696e673e416767726567617465204465766963653c2f737472696e673e3c6b65793e7569643c2f6b6579"
+     "3e3c737472696e673e44696c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b65414141414144696c6c6f"
+     "6e4672616e6b654141414141414141414141414141414132313c2f737472696e673e3c2f646963743e3c2f706c697374"
+     "3e00"},
+    {1010008, 20,
+     "7ef4118b4c000000273f91328c3be74e02eaed4c58690f00020000000000000000000000000000014601000000000000"
+     "0000000000000001460100000000000000000000a3000000460100000000000020000000000000000000000000000000"
+     "00000000000000000000000000000000000000000000000000000000000000003c3f786d6c2076657273696f6e3d2231"
+     "2e302220656e636f64696e673d225554462d38223f3e3c21444f435459504520706c697374205055424c494320222d2f"
+     "2f4170706c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d"
+     "2f445444732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076657273696f6e3d22312e3022"
+     "3e3c646963743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567617465204465766963653c2f"
+     "737472696e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b6541414141414469"
+     "6c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b654141414141414141414141414141414132313c2f73"
+     "7472696e673e3c2f646963743e3c2f706c6973743e003c3f786d6c2076657273696f6e3d22312e302220656e636f6469"
+     "6e673d225554462d38223f3e3c21444f435459504520706c697374205055424c494320222d2f2f4170706c652f2f4454"
+     "4420504c49535420312e302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d2f445444732f50726f70"
+     "657274794c6973742d312e302e647464223e3c706c6973742076657273696f6e3d22312e30223e3c646963743e3c6b65"
+     "793e6e616d653c2f6b65793e3c737472696e673e416767726567617465204465766963653c2f737472696e673e3c6b65"
+     "793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b65"
+     "414141414144696c6c6f6e4672616e6b654141414141414141414141414141414132313c2f737472696e673e3c2f6469"
+     "63743e3c2f706c6973743e00"},
+    {1010009, 20,
+     "5bc5bed738000000667eb817e93a9643fdc409c559690f00010000000000000000000000000000014601000000000000"
+     "00000000a300000000000000200000000000000000000000000000000000000000000000000000000000000000000000"
+     "0000000000000000000000003c3f786d6c2076657273696f6e3d22312e302220656e636f64696e673d225554462d3822"
+     "3f3e3c21444f435459504520706c697374205055424c494320222d2f2f4170706c652f2f44544420504c49535420312e"
+     "302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d2f445444732f50726f70657274794c6973742d31"
+     "2e302e647464223e3c706c6973742076657273696f6e3d22312e30223e3c646963743e3c6b65793e6e616d653c2f6b65"
+     "793e3c737472696e673e416767726567617465204465766963653c2f737472696e673e3c6b65793e7569643c2f6b6579"
+     "3e3c737472696e673e44696c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b65414141414144696c6c6f"
+     "6e4672616e6b654141414141414141414141414141414132313c2f737472696e673e3c2f646963743e3c2f706c697374"
+     "3e00"},
+    {1010010, 20,
+     "314117e934000000a5bc83702e384036aeef20305a690f0001000000000000002ad895e4000011000000000000000000"
+     "000000000000000020000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "0000000000000000"},
+    {1010011, 20,
+     "1470b8b534000000e4fdaa554b39313b51c1c4b95b690f000100000000000000cc7b719f000011000000000000000000"
+     "000000000000000020000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "0000000000000000"},
+    {1010012, 20,
+     "f1e4994e240000002339b5b6c97ce09f7a8431ab5c690f0070923b3b0000000000000000000000002000000000000000"
+     "00000000000000000000000000000000000000000000000000000000000000000000000000000000"},
+    {1010013, 20,
+     "d4d536123000000062789c93ac7d919285aad5225d690f009631df400000000000000000000000000000000000000000"
+     "000000002000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "00000000"},
+    {1010014, 20,
+     "be519f2c30000000a1baa7f46b7f47e7d681fcd75e690f009c7bbf660000000000000000000000000000000000000000"
+     "000000002000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "00000000"},
+    {1010015, 20,
+     "9b6030f048000000e0fb8ed10e7e36ea29af185e5f690f00010000000000000000000000000000014601000000000000"
+     "000000000000000070757267626f6c67ffffffff46010000000000002000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000003c3f786d6c2076657273696f6e3d22312e302220"
+     "656e636f64696e673d225554462d38223f3e3c21444f435459504520706c697374205055424c494320222d2f2f417070"
+     "6c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d2f445444"
+     "732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076657273696f6e3d22312e30223e3c6469"
+     "63743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567617465204465766963653c2f73747269"
+     "6e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b65414141414144696c6c6f6e"
+     "4672616e6b65414141414144696c6c6f6e4672616e6b654141414141414141414141414141414132313c2f737472696e"
+     "673e3c2f646963743e3c2f706c6973743e00"},
+    {1010016, 20,
+     "84cfeeb7300000001f1b6909f94c2e7008b4cb5a60690f00c87171990000000070757267626f6c67ffffffff00000000"
+     "000000002000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "00000000"},
+    {1010017, 20,
+     "a1fe41eb340000005e5a402c9c4d5f7df79a2fd361690f002ed295e2000000000000000070757267626f6c67ffffffff"
+     "000000000000000020000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "0000000000000000"},
+    {1010018, 20,
+     "cb7ae8d5480000009d987b4b5b4f8908a4b1062662690f00010000000000000000000000000000014601000000000000"
+     "000000000000000070757267626f6c67ffffffffa3000000000000002000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000003c3f786d6c2076657273696f6e3d22312e302220"
+     "656e636f64696e673d225554462d38223f3e3c21444f435459504520706c697374205055424c494320222d2f2f417070"
+     "6c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d2f445444"
+     "732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076657273696f6e3d22312e30223e3c6469"
+     "63743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567617465204465766963653c2f73747269"
+     "6e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b65414141414144696c6c6f6e"
+     "4672616e6b65414141414144696c6c6f6e4672616e6b654141414141414141414141414141414132313c2f737472696e"
+     "673e3c2f646963743e3c2f706c6973743e00"},
+    {1010019, 20,
+     "ee4b478930000000dcd9526e3e4ef8055b9fe2af63690f00c23b11bf0000000070757267626f6c67ffffffff00000000"
+     "000000002000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "00000000"},
+    {1010020, 20,
+     "0bdf66f2480000001b1d4d8dbc0b29a170da17bd64690f00010000000000000000000000000000014601000000000000"
+     "000000000000000070757267626f6c67ffffffff51000000000000002000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000003c3f786d6c2076657273696f6e3d22312e302220"
+     "656e636f64696e673d225554462d38223f3e3c21444f435459504520706c697374205055424c494320222d2f2f417070"
+     "6c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d2f445444"
+     "732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076657273696f6e3d22312e30223e3c6469"
+     "63743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567617465204465766963653c2f73747269"
+     "6e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b65414141414144696c6c6f6e"
+     "4672616e6b65414141414144696c6c6f6e4672616e6b654141414141414141414141414141414132313c2f737472696e"
+     "673e3c2f646963743e3c2f706c6973743e00"},
+    {1010021, 20,
+     "2eeec9ae300000005a5c64a8d90a58ac8ff4f33465690f009871bf600000000070757267626f6c67ffffffff00000000"
+     "000000002000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "00000000"},
+    {1010022, 20,
+     "446a609034000000999e5fcf1e088ed9dcdfdac166690f00923bdf46000000000000000070757267626f6c67ffffffff"
+     "000000000000000020000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "0000000000000000"},
+    {1010023, 20,
+     "615bcfcc30000000d8df76ea7b09ffd423f13e4867690f0074983b3d0000000070757267626f6c67ffffffff00000000"
+     "000000002000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "00000000"},
+    {1010024, 20,
+     "b994a752340000001717210173c360da91287e9668690f009d2a16d2000000000000000070757267626f6c67ffffffff"
+     "000000000000000020000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "0000000000000000"},
+    {1010025, 20,
+     "9ca5080e300000005656082416c211d76e069a1f69690f007b89f2a90000000070757267626f6c67ffffffff00000000"
+     "000000002000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "00000000"},
+    {1010026, 20,
+     "f621a1303000000095943343d1c0c7a23d2db3ea6a690f0071c3928f0000000070757267626f6c67ffffffff00000000"
+     "000000002000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "00000000"},
+    {1010027, 20,
+     "d3100e6c30000000d4d51a66b4c1b6afc20357636b690f00976076f40000000070757267626f6c67ffffffff00000000"
+     "000000002000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "00000000"},
+    {1010028, 20,
+     "36842f1730000000131105853684670be946a2716c690f002b893c500000000070757267626f6c67ffffffff00000000"
+     "000000002000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "00000000"},
+    {1010029, 20,
+     "13b580cb5c00000052502ca053851606166846f86d690f00020000000000000000000000000000014601000000000000"
+     "0000000000000001460100000000000000000000000000000000000070757267626f6c67460100004601000000000000"
+     "200000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "3c3f786d6c2076657273696f6e3d22312e302220656e636f64696e673d225554462d38223f3e3c21444f435459504520"
+     "706c697374205055424c494320222d2f2f4170706c652f2f44544420504c49535420312e302f2f454e22202268747470"
+     "3a2f2f7777772e6170706c652e636f6d2f445444732f50726f70657274794c6973742d312e302e647464223e3c706c69"
+     "73742076657273696f6e3d22312e30223e3c646963743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e4167"
+     "67726567617465204465766963653c2f737472696e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c"
+     "6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b654141414141"
+     "414141414141414141414132313c2f737472696e673e3c2f646963743e3c2f706c6973743e003c3f786d6c2076657273"
+     "696f6e3d22312e302220656e636f64696e673d225554462d38223f3e3c21444f435459504520706c697374205055424c"
+     "494320222d2f2f4170706c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f7777772e617070"
+     "6c652e636f6d2f445444732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076657273696f6e"
+     "3d22312e30223e3c646963743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567617465204465"
+     "766963653c2f737472696e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b6541"
+     "4141414144696c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b65414141414141414141414141414141"
+     "4132313c2f737472696e673e3c2f646963743e3c2f706c6973743e00"},
+    {1010030, 20,
+     "7931297534000000919217c79487c07345436f0d6e690f00c760b80d000000000000000070757267626f6c67ffffffff"
+     "000000000000000020000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "0000000000000000"},
+    {1010031, 20,
+     "5c00862934000000d0d33ee2f186b17eba6d8b846f690f0021c35c76000000000000000070757267626f6c67ffffffff"
+     "000000000000000020000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "0000000000000000"},
+    {1010032, 20,
+     "b554a8e5380000000f03f918ac1b93045ecabfec70690f00198d940b00000000000000000000000070757267626f6c67"
+     "ffffffff0000000000000000200000000000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000"},
+    {1010033, 20,
+     "906507b9480000004e42d03dc91ae209a1e45b6571690f00010000000000000000000000000000014601000000000000"
+     "000000000000000070757267626f6c67ffffffffa3000000000000002000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000003c3f786d6c2076657273696f6e3d22312e302220"
+     "656e636f64696e673d225554462d38223f3e3c21444f435459504520706c697374205055424c494320222d2f2f417070"
+     "6c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d2f445444"
+     "732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076657273696f6e3d22312e30223e3c6469"
+     "63743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567617465204465766963653c2f73747269"
+     "6e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b65414141414144696c6c6f6e"
+     "4672616e6b65414141414144696c6c6f6e4672616e6b654141414141414141414141414141414132313c2f737472696e"
+     "673e3c2f646963743e3c2f706c6973743e00"},
+    {1010034, 20,
+     "fae1ae87480000008d80eb5a0e18347cf2cf729072690f00010000000000000000000000000000014601000000000000"
+     "000000000000000070757267626f6c67ffffffff46010000000000002000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000003c3f786d6c2076657273696f6e3d22312e302220"
+     "656e636f64696e673d225554462d38223f3e3c21444f435459504520706c697374205055424c494320222d2f2f417070"
+     "6c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d2f445444"
+     "732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076657273696f6e3d22312e30223e3c6469"
+     "63743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567617465204465766963653c2f73747269"
+     "6e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b65414141414144696c6c6f6e"
+     "4672616e6b65414141414144696c6c6f6e4672616e6b654141414141414141414141414141414132313c2f737472696e"
+     "673e3c2f646963743e3c2f706c6973743e00"},
+    {1010035, 20,
+     "dfd001db30000000ccc1c27f6b1945710de1961973690f0013c7f42d0000000000000000000000000000000000000000"
+     "000000002000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "00000000"},
+    {1010036, 20,
+     "3a4420a0300000000b05dd9ce95c94d526a4630b74690f00af2ebe890000000000000000000000000000000000000000"
+     "000000002000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "00000000"},
+    {1010037, 20,
+     "1f758ffc4c0000004a44f4b98c5de5d8d98a878275690f000200000000000000498d5af2000011000000000000000000"
+     "000000014601000000000000000000000000000000000000a30000000000000020000000000000000000000000000000"
+     "00000000000000000000000000000000000000000000000000000000000000003c3f786d6c2076657273696f6e3d2231"
+     "2e302220656e636f64696e673d225554462d38223f3e3c21444f435459504520706c697374205055424c494320222d2f"
+     "2f4170706c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d"
+     "2f445444732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076657273696f6e3d22312e3022"
+     "3e3c646963743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567617465204465766963653c2f"
+     "737472696e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b6541414141414469"
+     "6c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b654141414141414141414141414141414132313c2f73"
+     "7472696e673e3c2f646963743e3c2f706c6973743e00"},
+    {1010038, 20,
+     "75f126c23c0000008986cfde4b5f33ad8aa1ae7776690f00010000000000000000000000000000014601000000000000"
+     "000000000000000046010000000000002000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000000000003c3f786d6c2076657273696f6e3d22312e302220656e636f64696e673d225554"
+     "462d38223f3e3c21444f435459504520706c697374205055424c494320222d2f2f4170706c652f2f44544420504c4953"
+     "5420312e302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d2f445444732f50726f70657274794c69"
+     "73742d312e302e647464223e3c706c6973742076657273696f6e3d22312e30223e3c646963743e3c6b65793e6e616d65"
+     "3c2f6b65793e3c737472696e673e416767726567617465204465766963653c2f737472696e673e3c6b65793e7569643c"
+     "2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b65414141414144"
+     "696c6c6f6e4672616e6b654141414141414141414141414141414132313c2f737472696e673e3c2f646963743e3c2f70"
+     "6c6973743e00"},
+    {1010039, 20,
+     "50c0899e28000000c8c7e6fb2e5e42a0758f4afe77690f00a564deaf0000000000000000000000000000000020000000"
+     "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"},
+    {1010040, 20,
+     "880fe18048000000070fb1102694ddaec7560a2078690f00010000000000000000000000000000014601000000000000"
+     "000000000000000070757267626f6c67ffffffff46010000000000002000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000003c3f786d6c2076657273696f6e3d22312e302220"
+     "656e636f64696e673d225554462d38223f3e3c21444f435459504520706c697374205055424c494320222d2f2f417070"
+     "6c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d2f445444"
+     "732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076657273696f6e3d22312e30223e3c6469"
+     "63743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567617465204465766963653c2f73747269"
+     "6e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b65414141414144696c6c6f6e"
+     "4672616e6b65414141414144696c6c6f6e4672616e6b654141414141414141414141414141414132313c2f737472696e"
+     "673e3c2f646963743e3c2f706c6973743e00"},
+    {1010041, 20,
+     "ad3e4edc48000000464e98354395aca33878eea979690f00010000000000000000000000000000014601000000000000"
+     "000000000000000070757267626f6c67ffffffffa3000000000000002000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000003c3f786d6c2076657273696f6e3d22312e302220"
+     "656e636f64696e673d225554462d38223f3e3c21444f435459504520706c697374205055424c494320222d2f2f417070"
+     "6c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d2f445444"
+     "732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076657273696f6e3d22312e30223e3c6469"
+     "63743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567617465204465766963653c2f73747269"
+     "6e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b65414141414144696c6c6f6e"
+     "4672616e6b65414141414144696c6c6f6e4672616e6b654141414141414141414141414141414132313c2f737472696e"
+     "673e3c2f646963743e3c2f706c6973743e00"},
+    {1010042, 20,
+     "c7bae7e248000000858ca35284977ad66b53c75c7a690f00010000000000000000000000000000014601000000000000"
+     "000000000000000070757267626f6c67ffffffff46010000000000002000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000003c3f786d6c2076657273696f6e3d22312e302220"
+     "656e636f64696e673d225554462d38223f3e3c21444f435459504520706c697374205055424c494320222d2f2f417070"
+     "6c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d2f445444"
+     "732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076657273696f6e3d22312e30223e3c6469"
+     "63743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567617465204465766963653c2f73747269"
+     "6e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b65414141414144696c6c6f6e"
+     "4672616e6b65414141414144696c6c6f6e4672616e6b654141414141414141414141414141414132313c2f737472696e"
+     "673e3c2f646963743e3c2f706c6973743e00"},
+    {1010043, 20,
+     "e28b48be48000000c4cd8a77e1960bdb947d23d57b690f00010000000000000000000000000000014601000000000000"
+     "000000000000000070757267626f6c67ffffffff46010000000000002000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000003c3f786d6c2076657273696f6e3d22312e302220"
+     "656e636f64696e673d225554462d38223f3e3c21444f435459504520706c697374205055424c494320222d2f2f417070"
+     "6c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d2f445444"
+     "732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076657273696f6e3d22312e30223e3c6469"
+     "63743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567617465204465766963653c2f73747269"
+     "6e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b65414141414144696c6c6f6e"
+     "4672616e6b65414141414144696c6c6f6e4672616e6b654141414141414141414141414141414132313c2f737472696e"
+     "673e3c2f646963743e3c2f706c6973743e00"},
+    {1010044, 20,
+     "071f69c5480000000309959463d3da7fbf38d6c77c690f00010000000000000000000000000000014601000000000000"
+     "000000000000000070757267626f6c67ffffffffa3000000000000002000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000003c3f786d6c2076657273696f6e3d22312e302220"
+     "656e636f64696e673d225554462d38223f3e3c21444f435459504520706c697374205055424c494320222d2f2f417070"
+     "6c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d2f445444"
+     "732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076657273696f6e3d22312e30223e3c6469"
+     "63743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567617465204465766963653c2f73747269"
+     "6e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b65414141414144696c6c6f6e"
+     "4672616e6b65414141414144696c6c6f6e4672616e6b654141414141414141414141414141414132313c2f737472696e"
+     "673e3c2f646963743e3c2f706c6973743e00"},
+    {1010045, 20,
+     "222ec699480000004248bcb106d2ab724016324e7d690f00010000000000000000000000000000014601000000000000"
+     "000000000000000070757267626f6c67ffffffff46010000000000002000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000003c3f786d6c2076657273696f6e3d22312e302220"
+     "656e636f64696e673d225554462d38223f3e3c21444f435459504520706c697374205055424c494320222d2f2f417070"
+     "6c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d2f445444"
+     "732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076657273696f6e3d22312e30223e3c6469"
+     "63743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567617465204465766963653c2f73747269"
+     "6e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b65414141414144696c6c6f6e"
+     "4672616e6b65414141414144696c6c6f6e4672616e6b654141414141414141414141414141414132313c2f737472696e"
+     "673e3c2f646963743e3c2f706c6973743e00"},
+    {1010046, 20,
+     "48aa6fa748000000818a87d6c1d07d07133d1bbb7e690f00010000000000000000000000000000014601000000000000"
+     "000000000000000070757267626f6c67ffffffff51000000000000002000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000003c3f786d6c2076657273696f6e3d22312e302220"
+     "656e636f64696e673d225554462d38223f3e3c21444f435459504520706c697374205055424c494320222d2f2f417070"
+     "6c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d2f445444"
+     "732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076657273696f6e3d22312e30223e3c6469"
+     "63743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567617465204465766963653c2f73747269"
+     "6e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b65414141414144696c6c6f6e"
+     "4672616e6b65414141414144696c6c6f6e4672616e6b654141414141414141414141414141414132313c2f737472696e"
+     "673e3c2f646963743e3c2f706c6973743e00"},
+    {1010047, 20,
+     "6d9bc0fb5c000000c0cbaef3a4d10c0aec13ff327f690f00020000000000000000000000000000014601000000000000"
+     "0000000000000001460100000000000000000000000000000000000070757267626f6c6746010000a300000000000000"
+     "200000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "3c3f786d6c2076657273696f6e3d22312e302220656e636f64696e673d225554462d38223f3e3c21444f435459504520"
+     "706c697374205055424c494320222d2f2f4170706c652f2f44544420504c49535420312e302f2f454e22202268747470"
+     "3a2f2f7777772e6170706c652e636f6d2f445444732f50726f70657274794c6973742d312e302e647464223e3c706c69"
+     "73742076657273696f6e3d22312e30223e3c646963743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e4167"
+     "67726567617465204465766963653c2f737472696e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c"
+     "6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b654141414141"
+     "414141414141414141414132313c2f737472696e673e3c2f646963743e3c2f706c6973743e003c3f786d6c2076657273"
+     "696f6e3d22312e302220656e636f64696e673d225554462d38223f3e3c21444f435459504520706c697374205055424c"
+     "494320222d2f2f4170706c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f7777772e617070"
+     "6c652e636f6d2f445444732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076657273696f6e"
+     "3d22312e30223e3c646963743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567617465204465"
+     "766963653c2f737472696e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b6541"
+     "4141414144696c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b65414141414141414141414141414141"
+     "4132313c2f737472696e673e3c2f646963743e3c2f706c6973743e00"},
+    {1010048, 20,
+     "e2fb449a5c000000fecb80cfa62dabce431f3de980690f00020000000000000000000000000000014601000000000000"
+     "0000000000000001460100000000000000000000000000000000000070757267626f6c67a3000000a300000000000000"
+     "200000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "3c3f786d6c2076657273696f6e3d22312e302220656e636f64696e673d225554462d38223f3e3c21444f435459504520"
+     "706c697374205055424c494320222d2f2f4170706c652f2f44544420504c49535420312e302f2f454e22202268747470"
+     "3a2f2f7777772e6170706c652e636f6d2f445444732f50726f70657274794c6973742d312e302e647464223e3c706c69"
+     "73742076657273696f6e3d22312e30223e3c646963743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e4167"
+     "67726567617465204465766963653c2f737472696e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c"
+     "6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b654141414141"
+     "414141414141414141414132313c2f737472696e673e3c2f646963743e3c2f706c6973743e003c3f786d6c2076657273"
+     "696f6e3d22312e302220656e636f64696e673d225554462d38223f3e3c21444f435459504520706c697374205055424c"
+     "494320222d2f2f4170706c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f7777772e617070"
+     "6c652e636f6d2f445444732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076657273696f6e"
+     "3d22312e30223e3c646963743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567617465204465"
+     "766963653c2f737472696e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b6541"
+     "4141414144696c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b65414141414141414141414141414141"
+     "4132313c2f737472696e673e3c2f646963743e3c2f706c6973743e00"},
+    {1010049, 20,
+     "c7caebc65c000000bf8aa9eac32cdac3bc31d96081690f00020000000000000000000000000000014601000000000000"
+     "0000000000000001460100000000000000000000000000000000000070757267626f6c6746010000a300000000000000"
+     "200000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "3c3f786d6c2076657273696f6e3d22312e302220656e636f64696e673d225554462d38223f3e3c21444f435459504520"
+     "706c697374205055424c494320222d2f2f4170706c652f2f44544420504c49535420312e302f2f454e22202268747470"
+     "3a2f2f7777772e6170706c652e636f6d2f445444732f50726f70657274794c6973742d312e302e647464223e3c706c69"
+     "73742076657273696f6e3d22312e30223e3c646963743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e4167"
+     "67726567617465204465766963653c2f737472696e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c"
+     "6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b654141414141"
+     "414141414141414141414132313c2f737472696e673e3c2f646963743e3c2f706c6973743e003c3f786d6c2076657273"
+     "696f6e3d22312e302220656e636f64696e673d225554462d38223f3e3c21444f435459504520706c697374205055424c"
+     "494320222d2f2f4170706c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f7777772e617070"
+     "6c652e636f6d2f445444732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076657273696f6e"
+     "3d22312e30223e3c646963743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567617465204465"
+     "766963653c2f737472696e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b6541"
+     "4141414144696c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b65414141414141414141414141414141"
+     "4132313c2f737472696e673e3c2f646963743e3c2f706c6973743e00"},
+    {1010050, 20,
+     "ad4e42f85c0000007c48928d042e0cb6ef1af09582690f00020000000000000000000000000000014601000000000000"
+     "0000000000000001460100000000000000000000000000000000000070757267626f6c6746010000a300000000000000"
+     "200000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "3c3f786d6c2076657273696f6e3d22312e302220656e636f64696e673d225554462d38223f3e3c21444f435459504520"
+     "706c697374205055424c494320222d2f2f4170706c652f2f44544420504c49535420312e302f2f454e22202268747470"
+     "3a2f2f7777772e6170706c652e636f6d2f445444732f50726f70657274794c6973742d312e302e647464223e3c706c69"
+     "73742076657273696f6e3d22312e30223e3c646963743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e4167"
+     "67726567617465204465766963653c2f737472696e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c"
+     "6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b654141414141"
+     "414141414141414141414132313c2f737472696e673e3c2f646963743e3c2f706c6973743e003c3f786d6c2076657273"
+     "696f6e3d22312e302220656e636f64696e673d225554462d38223f3e3c21444f435459504520706c697374205055424c"
+     "494320222d2f2f4170706c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f7777772e617070"
+     "6c652e636f6d2f445444732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076657273696f6e"
+     "3d22312e30223e3c646963743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567617465204465"
+     "766963653c2f737472696e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b6541"
+     "4141414144696c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b65414141414141414141414141414141"
+     "4132313c2f737472696e673e3c2f646963743e3c2f706c6973743e00"},
+    {1010051, 20,
+     "887feda45c0000003d09bba8612f7dbb1034141c83690f00020000000000000000000000000000014601000000000000"
+     "0000000000000001460100000000000000000000000000000000000070757267626f6c67a30000004601000000000000"
+     "200000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "3c3f786d6c2076657273696f6e3d22312e302220656e636f64696e673d225554462d38223f3e3c21444f435459504520"
+     "706c697374205055424c494320222d2f2f4170706c652f2f44544420504c49535420312e302f2f454e22202268747470"
+     "3a2f2f7777772e6170706c652e636f6d2f445444732f50726f70657274794c6973742d312e302e647464223e3c706c69"
+     "73742076657273696f6e3d22312e30223e3c646963743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e4167"
+     "67726567617465204465766963653c2f737472696e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c"
+     "6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b654141414141"
+     "414141414141414141414132313c2f737472696e673e3c2f646963743e3c2f706c6973743e003c3f786d6c2076657273"
+     "696f6e3d22312e302220656e636f64696e673d225554462d38223f3e3c21444f435459504520706c697374205055424c"
+     "494320222d2f2f4170706c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f7777772e617070"
+     "6c652e636f6d2f445444732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076657273696f6e"
+     "3d22312e30223e3c646963743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567617465204465"
+     "766963653c2f737472696e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b6541"
+     "4141414144696c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b65414141414141414141414141414141"
+     "4132313c2f737472696e673e3c2f646963743e3c2f706c6973743e00"},
+    {1010052, 20,
+     "6debccdf5c000000facda44be36aac1f3b71e10e84690f00020000000000000000000000000000014601000000000000"
+     "0000000000000001460100000000000000000000000000000000000070757267626f6c6746010000a300000000000000"
+     "200000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "3c3f786d6c2076657273696f6e3d22312e302220656e636f64696e673d225554462d38223f3e3c21444f435459504520"
+     "706c697374205055424c494320222d2f2f4170706c652f2f44544420504c49535420312e302f2f454e22202268747470"
+     "3a2f2f7777772e6170706c652e636f6d2f445444732f50726f70657274794c6973742d312e302e647464223e3c706c69"
+     "73742076657273696f6e3d22312e30223e3c646963743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e4167"
+     "67726567617465204465766963653c2f737472696e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c"
+     "6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b654141414141"
+     "414141414141414141414132313c2f737472696e673e3c2f646963743e3c2f706c6973743e003c3f786d6c2076657273"
+     "696f6e3d22312e302220656e636f64696e673d225554462d38223f3e3c21444f435459504520706c697374205055424c"
+     "494320222d2f2f4170706c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f7777772e617070"
+     "6c652e636f6d2f445444732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076657273696f6e"
+     "3d22312e30223e3c646963743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567617465204465"
+     "766963653c2f737472696e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b6541"
+     "4141414144696c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b65414141414141414141414141414141"
+     "4132313c2f737472696e673e3c2f646963743e3c2f706c6973743e00"},
+    {1010053, 20,
+     "48da638354000000bb8c8d6e866bdd12c45f058785690f00020000000000000058fc9514000011000000000000000000"
+     "000000014601000000000000000000000000000000000000000000000000000000000000000000002000000000000000"
+     "000000000000000000000000000000000000000000000000000000000000000000000000000000003c3f786d6c207665"
+     "7273696f6e3d22312e302220656e636f64696e673d225554462d38223f3e3c21444f435459504520706c697374205055"
+     "424c494320222d2f2f4170706c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f7777772e61"
+     "70706c652e636f6d2f445444732f50726f70657274794c6973742d312e302e647464223e3c706c697374207665727369"
+     "6f6e3d22312e30223e3c646963743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e41676772656761746520"
+     "4465766963653c2f737472696e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b"
+     "65414141414144696c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b6541414141414141414141414141"
+     "41414132313c2f737472696e673e3c2f646963743e3c2f706c6973743e00"},
+    {1010054, 20,
+     "225ecabd3c000000784eb60941690b6797742c7286690f00010000000000000052b6f532000011000000000000000000"
+     "000000000000000000000000000000002000000000000000000000000000000000000000000000000000000000000000"
+     "00000000000000000000000000000000"},
+    {1010055, 20,
+     "076f65e130000000390f9f2c24687a6a685ac8fb87690f00b41511490000000070757267626f6c67ffffffff00000000"
+     "000000002000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "00000000"},
+    {1010056, 20,
+     "dfa00dff48000000f6c7c8c72ca2e564da83882588690f00010000000000000000000000000000014601000000000000"
+     "000000000000000070757267626f6c67ffffffff28000000000000002000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000003c3f786d6c2076657273696f6e3d22312e302220"
+     "656e636f64696e673d225554462d38223f3e3c21444f435459504520706c697374205055424c494320222d2f2f417070"
+     "6c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d2f445444"
+     "732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076657273696f6e3d22312e30223e3c6469"
+     "63743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567617465204465766963653c2f73747269"
+     "6e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b65414141414144696c6c6f6e"
+     "4672616e6b65414141414144696c6c6f6e4672616e6b654141414141414141414141414141414132313c2f737472696e"
+     "673e3c2f646963743e3c2f706c6973743e00"},
+    {1010057, 20,
+     "fa91a2a348000000b786e1e249a3946925ad6cac89690f00010000000000000000000000000000014601000000000000"
+     "000000000000000070757267626f6c67ffffffff28000000000000002000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000003c3f786d6c2076657273696f6e3d22312e302220"
+     "656e636f64696e673d225554462d38223f3e3c21444f435459504520706c697374205055424c494320222d2f2f417070"
+     "6c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f7777772e6170706c652e636f6d2f445444"
+     "732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076657273696f6e3d22312e30223e3c6469"
+     "63743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567617465204465766963653c2f73747269"
+     "6e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e4672616e6b65414141414144696c6c6f6e"
+     "4672616e6b65414141414144696c6c6f6e4672616e6b654141414141414141414141414141414132313c2f737472696e"
+     "673e3c2f646963743e3c2f706c6973743e00"},
+    {1010058, 20,
+     "90150b9d340000007444da858ea1421c768645598a690f000100000000000000b14eb8fb000011000000000000000000"
+     "000000000000000020000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "0000000000000000"},
+    {1010059, 20,
+     "b524a441240000003505f3a0eba0331189a8a1d08b690f0057ed5c800000000000000000000000002000000000000000"
+     "00000000000000000000000000000000000000000000000000000000000000000000000000000000"},
+    {1010060, 20,
+     "50b085ba58000000f2c1ec4369e5e2b5a2ed54c28c690f000200000000000000eb041624000011000000000000000000"
+     "0000000146010000000000000000000000000000000000000000000000000000a3000000000000000000000020000000"
+     "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000003c3f786d"
+     "6c2076657273696f6e3d22312e302220656e636f64696e673d225554462d38223f3e3c21444f435459504520706c6973"
+     "74205055424c494320222d2f2f4170706c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f77"
+     "77772e6170706c652e636f6d2f445444732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076"
+     "657273696f6e3d22312e30223e3c646963743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567"
+     "617465204465766963653c2f737472696e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e46"
+     "72616e6b65414141414144696c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b65414141414141414141"
+     "4141414141414132313c2f737472696e673e3c2f646963743e3c2f706c6973743e00"},
+    {1010061, 20,
+     "75812ae658000000b380c5660ce493b85dc3b04b8d690f0002000000000000000da7f25f000011000000000000000000"
+     "0000000146010000000000000000000000000000000000000000000000000000a3000000000000000000000020000000"
+     "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000003c3f786d"
+     "6c2076657273696f6e3d22312e302220656e636f64696e673d225554462d38223f3e3c21444f435459504520706c6973"
+     "74205055424c494320222d2f2f4170706c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f77"
+     "77772e6170706c652e636f6d2f445444732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076"
+     "657273696f6e3d22312e30223e3c646963743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567"
+     "617465204465766963653c2f737472696e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e46"
+     "72616e6b65414141414144696c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b65414141414141414141"
+     "4141414141414132313c2f737472696e673e3c2f646963743e3c2f706c6973743e00"},
+    {1010062, 20,
+     "1f0583d8580000007042fe01cbe645cd0ee899be8e690f00020000000000000007ed9279000011000000000000000000"
+     "0000000146010000000000000000000000000000000000000000000000000000a3000000000000000000000020000000"
+     "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000003c3f786d"
+     "6c2076657273696f6e3d22312e302220656e636f64696e673d225554462d38223f3e3c21444f435459504520706c6973"
+     "74205055424c494320222d2f2f4170706c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f77"
+     "77772e6170706c652e636f6d2f445444732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076"
+     "657273696f6e3d22312e30223e3c646963743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567"
+     "617465204465766963653c2f737472696e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e46"
+     "72616e6b65414141414144696c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b65414141414141414141"
+     "4141414141414132313c2f737472696e673e3c2f646963743e3c2f706c6973743e00"},
+    {1010063, 20,
+     "3a342c84340000003103d724aee734c0f1c67d378f690f000100000000000000e14e7602000011000000000000000000"
+     "000000000000000020000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "0000000000000000"},
+    {1010064, 20,
+     "d36002c83c000000eed310def37a16ba1561495f90690f000100000000000000d900be7f000011000000000000000000"
+     "000000000000000000000000000000002000000000000000000000000000000000000000000000000000000000000000"
+     "00000000000000000000000000000000"},
+    {1010065, 20,
+     "f651ad9434000000af9239fb967b67b7ea4fadd691690f0001000000000000003fa35a04000011000000000000000000"
+     "000000000000000020000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "0000000000000000"},
+    {1010066, 20,
+     "9cd504aa580000006c50029c5179b1c2b964842392690f00020000000000000035e93a22000011000000000000000000"
+     "0000000146010000000000000000000000000000000000000000000000000000a3000000000000000000000020000000"
+     "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000003c3f786d"
+     "6c2076657273696f6e3d22312e302220656e636f64696e673d225554462d38223f3e3c21444f435459504520706c6973"
+     "74205055424c494320222d2f2f4170706c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f77"
+     "77772e6170706c652e636f6d2f445444732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076"
+     "657273696f6e3d22312e30223e3c646963743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567"
+     "617465204465766963653c2f737472696e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e46"
+     "72616e6b65414141414144696c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b65414141414141414141"
+     "4141414141414132313c2f737472696e673e3c2f646963743e3c2f706c6973743e00"},
+    {1010067, 20,
+     "b9e4abf6240000002d112bb93478c0cf464a60aa93690f00d34ade590000000000000000000000002000000000000000"
+     "00000000000000000000000000000000000000000000000000000000000000000000000000000000"},
+    {1010068, 20,
+     "5c708a8d24000000ead5345ab63d116b6d0f95b894690f006fa394fd0000000000000000000000002000000000000000"
+     "00000000000000000000000000000000000000000000000000000000000000000000000000000000"},
+    {1010069, 20,
+     "794125d14c000000ab941d7fd33c60669221713195690f00030000000000000089007086000011000000000000000000"
+     "000010000000000000000000000010000000000000000000000000000000000020000000000000000000000000000000"
+     "0000000000000000000000000000000000000000000000000000000000000000"},
+    {1010070, 20,
+     "13c58cef5400000068562618143eb613c10a58c496690f000300000000000000834a10a0000011000000000000000000"
+     "000011000000000000000000000011000000000000000000000000000000000000000000000000002000000000000000"
+     "00000000000000000000000000000000000000000000000000000000000000000000000000000000"},
+    {1010071, 20,
+     "36f423b35800000029170f3d713fc71e3e24bc4d97690f00020000000000000065e9f4db000011000000000000000000"
+     "0000000146010000000000000000000000000000000000000000000000000000a3000000000000000000000020000000"
+     "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000003c3f786d"
+     "6c2076657273696f6e3d22312e302220656e636f64696e673d225554462d38223f3e3c21444f435459504520706c6973"
+     "74205055424c494320222d2f2f4170706c652f2f44544420504c49535420312e302f2f454e222022687474703a2f2f77"
+     "77772e6170706c652e636f6d2f445444732f50726f70657274794c6973742d312e302e647464223e3c706c6973742076"
+     "657273696f6e3d22312e30223e3c646963743e3c6b65793e6e616d653c2f6b65793e3c737472696e673e416767726567"
+     "617465204465766963653c2f737472696e673e3c6b65793e7569643c2f6b65793e3c737472696e673e44696c6c6f6e46"
+     "72616e6b65414141414144696c6c6f6e4672616e6b65414141414144696c6c6f6e4672616e6b65414141414141414141"
+     "4141414141414132313c2f737472696e673e3c2f646963743e3c2f706c6973743e00"},
+    {1010072, 20,
+     "ee3b4b2d54030000e6df58d679f558108cfdfc9398690f008c5b00000000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000000000000000000000000000002000000000000000"
+     "00000000000000000000000000000000000000000000000000000000000000000000000000000000"},
+    {1, 20,
+     "9d44e04551030000ec371f518978bee774a0f18a010000001b3d00000000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000000000000000000000002000000000000000000000"
+     "00000000000000000000000000000000000000000000000000000000000000000000000000"},
+};
+
+#endif // GOLDEN_MESSAGES_H
@@ -0,0 +1,187 @@
+/* 
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+// Minimises a crashing sample with helpers/sample_minimizer.h. A candidate
+// reproduces if the command dies from the same signal as it does on the
+// original sample.
+//
+//   ./minimize_sample [-o output] [-T timeout_ms] sample -- command ...
+//
+// @@ in the command is replaced with the path of the candidate, e.g.
+//
+//   ./minimize_sample crash -- ./harness -f @@                       # macOS
+//   MOCK_CRASH=1 ./minimize_sample crash -- ./mock_harness -f @@     # Linux stand-in
+//
+// The output defaults to the sample's path with .min appended.
+
+#include "sample_minimizer.h"
+#include "tool_util.h"
+
+#include <getopt.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <string>
+
+typedef struct {
+    std::vector<std::string> command;
+    std::string candidate_path;
+    double timeout;
+    int signal;             // what the original sample dies from
+} command_oracle_t;
+
+static bool write_sample(const char *file_path, const std::vector<uint8_t>& sample) {
+    FILE *file = fopen(file_path, "wb");
+    if (!file) {
+        perror(file_path);
+        return false;
+    }
+
+    bool written = fwrite(sample.data(), 1, sample.size(), file) == sample.size();
+    fclose(file);
+    return written;
+}
+
+// Run the command on the sample, returning the signal it died from, 0 if it
+// exited and -1 if it timed out
+static int run_command(const command_oracle_t& oracle, const std::vector<uint8_t>& sample) {
+    if (!write_sample(oracle.candidate_path.c_str(), sample)) {
+        exit(EXIT_FAILURE);
+    }
+
+    std::vector<std::string> args;
+    std::vector<char *> argv;
+    for (const std::string& arg : oracle.command) {
+        args.push_back(arg == "@@" ? oracle.candidate_path : arg);
+    }
+    for (std::string& arg : args) {
+        argv.push_back(&arg[0]);
+    }
+    argv.push_back(NULL);
+
+    pid_t pid = fork();
+    if (pid == 0) {
+        // Crashing targets tend to be chatty
+        freopen("/dev/null", "w", stdout);
+        freopen("/dev/null", "w", stderr);
+        execvp(argv[0], argv.data());
+        _exit(127);
+    }
+
+    double deadline = now_seconds() + oracle.timeout;
+    int status;
+    while (waitpid(pid, &status, WNOHANG) != pid) {
+        if (now_seconds() > deadline) {
+            kill(pid, SIGKILL);
+            waitpid(pid, NULL, 0);
+            return -1;
+        }
+        usleep(100);
+    }
+
+    return WIFSIGNALED(status) ? WTERMSIG(status) : 0;
+}
+
+static bool same_crash(const std::vector<uint8_t>& sample, void *arg) {
+    const command_oracle_t *oracle = (const command_oracle_t *)arg;
+    return run_command(*oracle, sample) == oracle->signal;
+}
+
+int main(int argc, char *argv[]) {
+    command_oracle_t oracle;
+    const char *output_path = NULL;
+    oracle.timeout = 5.0;
+
+    // Everything after -- is the command line
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--") == 0) {
+            oracle.command.assign(argv + i + 1, argv + argc);
+            argc = i;
+            break;
+        }
+    }
+
+    int opt;
+    while ((opt = getopt(argc, argv, "o:T:")) != -1) {
+        switch (opt) {
+            case 'o':
+                output_path = optarg;
+                break;
+            case 'T':
+                oracle.timeout = strtod(optarg, NULL) / 1000;
+                break;
+            default:
+                fprintf(stderr, "Usage: %s [-o output] [-T timeout_ms] sample -- command ...\n", argv[0]);
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    if (optind != argc - 1 || oracle.command.empty()) {
+        fprintf(stderr, "Usage: %s [-o output] [-T timeout_ms] sample -- command ...\n", argv[0]);
+        exit(EXIT_FAILURE);
+    }
+
+    std::vector<uint8_t> sample;
+    if (!read_sample(argv[optind], sample)) {
+        return 1;
+    }
+    std::string default_output = std::string(argv[optind]) + ".min";
+    if (!output_path) {
+        output_path = default_output.c_str();
+    }
+
+    char candidate_path[] = "/tmp/minimize_sample_XXXXXX";
+    int fd = mkstemp(candidate_path);
+    if (fd == -1) {
+        perror("mkstemp");
+        return 1;
+    }
+    close(fd);
+    oracle.candidate_path = candidate_path;
+
+    oracle.signal = run_command(oracle, sample);
+    if (oracle.signal <= 0) {
+        fprintf(stderr, "The sample doesn't crash the command\n");
+        unlink(candidate_path);
+        return 1;
+    }
+
+    std::vector<uint8_t> minimized;
+    minimize_stats_t stats;
+    double start = now_seconds();
+    bool reproduced = minimize_sample(sample, same_crash, &oracle, minimized, &stats);
+    double elapsed = now_seconds() - start;
+    unlink(candidate_path);
+
+    if (!reproduced) {
+        fprintf(stderr, "The crash doesn't reproduce\n");
+        return 1;
+    }
+    if (!write_sample(output_path, minimized)) {
+        return 1;
+    }
+
+    printf("signal:        %d (%s)\n", oracle.signal, strsignal(oracle.signal));
+    printf("messages:      %zu -> %zu\n", stats.messages_before, stats.messages_after);
+    printf("size:          %zu -> %zu bytes\n", stats.size_before, stats.size_after);
+    printf("executions:    %llu in %.2fs (%llu cached, %llu candidates skipped as undecodable)\n",
+           (unsigned long long)stats.executions, elapsed, (unsigned long long)stats.cache_hits,
+           (unsigned long long)stats.invalid);
+    printf("written to:    %s\n", output_path);
+
+    return 0;
+}
@@ -0,0 +1,25 @@
+/* 
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+// The harness with the same command line as on macOS, against the mock
+// processing function. Lets the shared memory and persistent mode plumbing
+// run on Linux, e.g. under persistent_driver.
+
+#include "harness.h"
+
+int main(int argc, char *argv[]) {
+    return harness_main(argc, argv);
+}
@@ -0,0 +1,235 @@
+/* 
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "mock_processing.h"
+#include "message_layout.h"
+#include "object_tracker.h"
+#include "resource_pool.h"
+
+#include <cstdlib>
+#include <cstring>
+
+uint64_t mock_message_count = 0;
+uint64_t mock_object_message_count = 0;
+uint64_t mock_next_object_id = 1;
+bool mock_planted_bug = false;
+
+#define MOCK_MAX_OBJECTS 1024
+#define UNSPECIFIED_ERROR 'what'    // kAudioHardwareUnspecifiedError
+
+typedef struct {
+    uint32_t object_id;
+    uint32_t object_class;
+    uint32_t base_class;
+    object_kind_t kind;
+} mock_object_t;
+
+static mock_object_t mock_objects[MOCK_MAX_OBJECTS];
+static size_t mock_object_count = 0;
+
+typedef union {
+    mock_reply_t basic;
+    mock_create_reply_t create;
+    mock_object_info_reply_t info;
+} mock_any_reply_t;
+
+// Keeps the compiler from optimising away the reads below
+static volatile uint32_t mock_checksum = 0;
+
+static int32_t check_descriptors(const message_layout_t& layout, const uint8_t *msg, uint32_t msg_size) {
+    uint32_t offset = MACH_MSG_HEADER_SIZE;
+    uint32_t descriptor_count;
+
+    if (offset + sizeof(uint32_t) > msg_size) {
+        return MIG_BAD_ARGUMENTS;
+    }
+    memcpy(&descriptor_count, msg + offset, sizeof(uint32_t));
+    offset += sizeof(uint32_t);
+
+    if (descriptor_count != layout.descriptor_count) {
+        return MIG_BAD_ARGUMENTS;
+    }
+
+    for (uint32_t i = 0; i < descriptor_count; i++) {
+        if (layout.descriptor_types[i] == MACH_MSG_PORT_DESCRIPTOR) {
+            mach_msg_port_descriptor_t port;
+            if (offset + sizeof(port) > msg_size) {
+                return MIG_BAD_ARGUMENTS;
+            }
+            memcpy(&port, msg + offset, sizeof(port));
+            if (port.type != MACH_MSG_PORT_DESCRIPTOR || port.disposition != 0x11) {
+                return MIG_BAD_ARGUMENTS;
+            }
+            offset += sizeof(port);
+        } else {
+            mach_msg_ool_descriptor_t ool;
+            if (offset + sizeof(ool) > msg_size) {
+                return MIG_BAD_ARGUMENTS;
+            }
+            memcpy(&ool, msg + offset, sizeof(ool));
+            if (ool.type != MACH_MSG_OOL_DESCRIPTOR) {
+                return MIG_BAD_ARGUMENTS;
+            }
+            // The kernel would have copied the OOL memory in, touch all of it
+            const uint8_t *data = (const uint8_t *)ool.address;
+            for (uint32_t j = 0; j < ool.size; j++) {
+                mock_checksum += data[j];
+            }
+            // Like a MIG server, take ownership of the memory and free it
+            if (ool.deallocate && ool.size > 0) {
+                pool_backend()->deallocate(ool.address, ool.size);
+            }
+            offset += sizeof(ool);
+        }
+    }
+
+    return 0;
+}
+
+static uint32_t create_object(object_kind_t kind, uint32_t object_class, uint32_t base_class) {
+    if (mock_object_count == MOCK_MAX_OBJECTS) {
+        return 0;
+    }
+
+    uint32_t object_id = (uint32_t)mock_next_object_id++;
+    mock_objects[mock_object_count++] = {object_id, object_class, base_class, kind};
+    return object_id;
+}
+
+static mock_object_t *find_object(uint32_t object_id) {
+    for (size_t i = 0; i < mock_object_count; i++) {
+        if (mock_objects[i].object_id == object_id) {
+            return &mock_objects[i];
+        }
+    }
+    return NULL;
+}
+
+static int32_t reply_created(mock_any_reply_t& reply, uint32_t object_id) {
+    if (object_id == 0) {
+        return UNSPECIFIED_ERROR;
+    }
+    reply.create.object_id = object_id;
+    reply.basic.header.msgh_size = sizeof(mock_create_reply_t);
+    return 0;
+}
+
+// What the handlers do with objects once the message itself checked out
+static int32_t handle_objects(uint32_t msg_id, const uint8_t *msg, mock_any_reply_t& reply) {
+    switch (msg_id) {
+        case XSystem_CreateIOContext:
+            return reply_created(reply, create_object(OBJECT_IO_CONTEXT, 'ioct', 'aobj'));
+        case XSystem_CreateMetaDevice:
+            return reply_created(reply, create_object(OBJECT_META_DEVICE, 'aagg', 'adev'));
+        default:
+            break;
+    }
+
+    object_kind_t kind = object_kind_for(msg_id);
+    if (kind == OBJECT_NONE) {
+        return 0;
+    }
+
+    uint32_t object_id;
+    memcpy(&object_id, msg + object_id_offset(message_layout_for(msg_id)), sizeof(uint32_t));
+
+    mock_object_t *object = find_object(object_id);
+    if (!object || (kind != OBJECT_ANY && object->kind != kind)) {
+        return BAD_OBJECT_ERROR;
+    }
+
+    mock_object_message_count++;
+
+    const message_layout_t& layout = message_layout_for(msg_id);
+    if (mock_planted_bug && object->kind == OBJECT_META_DEVICE && layout.has_selector) {
+        uint32_t selector;
+        memcpy(&selector, msg + layout.msg_size - 16, sizeof(uint32_t));
+        if (selector == 'tap#') {
+            abort();
+        }
+    }
+
+    switch (msg_id) {
+        case XSystem_GetObjectInfo:
+            reply.info.object_class = object->object_class;
+            reply.info.base_class = object->base_class;
+            reply.basic.header.msgh_size = sizeof(mock_object_info_reply_t);
+            return 0;
+        case XSystem_DestroyIOContext:
+        case XSystem_DestroyMetaDevice:
+            *object = mock_objects[--mock_object_count];
+            return 0;
+        case XTransportManager_CreateDevice:
+            return reply_created(reply, create_object(OBJECT_DEVICE, 'adev', 'aobj'));
+        default:
+            return 0;
+    }
+}
+
+uint64_t mock_processing_function(mach_msg_header_t *incoming_mach_msg, mach_msg_header_t *returning_mach_msg) {
+    const uint8_t *msg = (const uint8_t *)incoming_mach_msg;
+    uint32_t msg_id = incoming_mach_msg->msgh_id;
+    uint32_t msg_size = incoming_mach_msg->msgh_size;
+    mock_any_reply_t reply = {};
+
+    mock_message_count++;
+
+    reply.basic.header.msgh_size = sizeof(mock_reply_t);
+    reply.basic.header.msgh_remote_port = incoming_mach_msg->msgh_local_port;
+    reply.basic.header.msgh_id = msg_id + 100;
+
+    int32_t& ret_code = reply.basic.ret_code;
+    uint64_t handled = msg_id - kFirstMessageId < kMessageIdCount;
+    if (!handled) {
+        ret_code = MIG_BAD_ID;
+    } else if (msg_size < MACH_MSG_HEADER_SIZE || msg_size > MAX_MESSAGE_SIZE) {
+        ret_code = MIG_BAD_ARGUMENTS;
+    } else {
+        const message_layout_t& layout = message_layout_for(msg_id);
+        bool is_complex = (incoming_mach_msg->msgh_bits & MACH_MSGH_BITS_COMPLEX) != 0;
+
+        for (uint32_t i = MACH_MSG_HEADER_SIZE; i < msg_size; i++) {
+            mock_checksum += msg[i];
+        }
+
+        if (msg_size != layout.msg_size || is_complex != layout.is_ool) {
+            ret_code = MIG_BAD_ARGUMENTS;
+        } else if (layout.is_ool) {
+            ret_code = check_descriptors(layout, msg, msg_size);
+        }
+
+        if (ret_code == 0) {
+            ret_code = handle_objects(msg_id, msg, reply);
+        }
+    }
+
+    memcpy(returning_mach_msg, &reply, reply.basic.header.msgh_size);
+    return handled;
+}
+
+__attribute__((constructor))
+static void install_mock_processing_function(void) {
+    Mach_Processing_Function = mock_processing_function;
+    NextObjectID = &mock_next_object_id;
+    mock_planted_bug = getenv("MOCK_CRASH") != NULL;
+
+    // What the server has before any client connects
+    create_object(OBJECT_SYSTEM, 'asys', 'aobj');
+    create_object(OBJECT_ANY, 'aplg', 'aobj');
+    create_object(OBJECT_TRANSPORT_MANAGER, 'trpm', 'aplg');
+    create_object(OBJECT_DEVICE, 'adev', 'aobj');
+    create_object(OBJECT_ANY, 'astr', 'aobj');
+}
@@ -0,0 +1,75 @@
+/* 
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef MOCK_PROCESSING_H
+#define MOCK_PROCESSING_H
+
+#include "harness.h"
+
+// MIG return codes used in replies
+#define MIG_BAD_ID -303
+#define MIG_BAD_ARGUMENTS -304
+
+// Reply layout of a MIG routine without out parameters (mig_reply_error_t)
+typedef struct {
+    mach_msg_header_t header;
+    uint8_t ndr[8];
+    int32_t ret_code;
+} mock_reply_t;
+
+// Reply to the routines that create an object
+typedef struct {
+    mach_msg_header_t header;
+    uint8_t ndr[8];
+    int32_t ret_code;
+    uint32_t object_id;
+} mock_create_reply_t;
+
+// Reply to XSystem_GetObjectInfo, the classes are at the offsets in object_tracker.h
+typedef struct {
+    mach_msg_header_t header;
+    uint8_t ndr[8];
+    int32_t ret_code;
+    uint8_t unknown[12];
+    uint32_t object_class;
+    uint32_t base_class;
+} mock_object_info_reply_t;
+
+// Number of messages handled since start up
+extern uint64_t mock_message_count;
+
+// Number of messages that named an object of the right kind, i.e. made it
+// past the object lookup to the code behind it
+extern uint64_t mock_object_message_count;
+
+// The mock's sNextObjectID, NextObjectID points here
+extern uint64_t mock_next_object_id;
+
+// Crash like a real bug would, for tools that deal with crashes to find:
+// property calls with the 'tap#' selector on a meta device abort. Set when
+// MOCK_CRASH is in the environment.
+extern bool mock_planted_bug;
+
+// Stand-in for _HALB_MIGServer_server. Checks the message against its
+// layout, reads the body and any OOL memory the way the real server would,
+// and writes a MIG reply. It also keeps a table of objects like the server's
+// object map: the create and destroy routines add and remove objects, and
+// routines that take an object ID fail with '!obj' unless it names a live
+// object of the kind they work on. Linking tools/mock_processing.cc installs it as
+// Mach_Processing_Function.
+uint64_t mock_processing_function(mach_msg_header_t *incoming_mach_msg, mach_msg_header_t *returning_mach_msg);
+
+#endif // MOCK_PROCESSING_H
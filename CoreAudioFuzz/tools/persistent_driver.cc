@@ -0,0 +1,207 @@
+/* 
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+// Drives a harness in persistent mode over the shared memory handshake in
+// helpers/persistent.h: starts it, feeds it samples, starts a new one when it
+// reaches its iteration limit, crashes or hangs, and reports executions per
+// second.
+//
+//   ./persistent_driver [-n inputs] [-s input_size] [-t seconds] [-T timeout_ms] [sample ...] [-- command ...]
+//
+// @@ in the command is replaced with the shared memory name. The default
+// command is ./mock_harness -m @@ -p 1000.
+
+#include "persistent.h"
+#include "tool_util.h"
+
+#include <getopt.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+
+typedef struct {
+    pid_t pid;
+    double deadline;
+    bool timed_out;
+} harness_process_t;
+
+static pid_t start_harness(const std::vector<std::string>& command, const char *shm_name) {
+    std::vector<std::string> args;
+    std::vector<char *> argv;
+
+    for (const std::string& arg : command) {
+        args.push_back(arg == "@@" ? shm_name : arg);
+    }
+    for (std::string& arg : args) {
+        argv.push_back(&arg[0]);
+    }
+    argv.push_back(NULL);
+
+    pid_t pid = fork();
+    if (pid == 0) {
+        execvp(argv[0], argv.data());
+        perror(argv[0]);
+        _exit(127);
+    }
+    return pid;
+}
+
+static bool harness_alive(void *arg) {
+    harness_process_t *harness = (harness_process_t *)arg;
+
+    if (waitpid(harness->pid, NULL, WNOHANG) == harness->pid) {
+        return false;
+    }
+    if (now_seconds() > harness->deadline) {
+        kill(harness->pid, SIGKILL);
+        waitpid(harness->pid, NULL, 0);
+        harness->timed_out = true;
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    size_t input_count = 1000;
+    size_t input_size = 2000;
+    double duration = 5.0;
+    double timeout = 1.0;
+    std::vector<std::string> command = {"./mock_harness", "-m", "@@", "-p", "1000"};
+
+    // Everything after -- is the harness command line
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--") == 0) {
+            command.assign(argv + i + 1, argv + argc);
+            argc = i;
+            break;
+        }
+    }
+
+    int opt;
+    while ((opt = getopt(argc, argv, "n:s:t:T:")) != -1) {
+        switch (opt) {
+            case 'n':
+                input_count = strtoul(optarg, NULL, 0);
+                break;
+            case 's':
+                input_size = strtoul(optarg, NULL, 0);
+                break;
+            case 't':
+                duration = strtod(optarg, NULL);
+                break;
+            case 'T':
+                timeout = strtod(optarg, NULL) / 1000;
+                break;
+            default:
+                fprintf(stderr, "Usage: %s [-n inputs] [-s input_size] [-t seconds] [-T timeout_ms] [sample ...] [-- command ...]\n", argv[0]);
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    if (command.empty()) {
+        fprintf(stderr, "No harness command\n");
+        return 1;
+    }
+
+    std::vector<std::vector<uint8_t>> inputs;
+    if (optind < argc) {
+        for (int i = optind; i < argc; i++) {
+            std::vector<uint8_t> sample;
+            if (read_sample(argv[i], sample)) {
+                inputs.push_back(sample);
+            }
+        }
+    } else {
+        uint64_t state = 0x9e3779b97f4a7c15ULL;
+        for (size_t i = 0; i < input_count; i++) {
+            std::vector<uint8_t> input(input_size > MAX_SAMPLE_SIZE ? MAX_SAMPLE_SIZE : input_size);
+            for (size_t j = 0; j < input.size(); j++) {
+                state ^= state << 13;
+                state ^= state >> 7;
+                state ^= state << 17;
+                input[j] = (uint8_t)state;
+            }
+            inputs.push_back(input);
+        }
+    }
+
+    if (inputs.empty()) {
+        fprintf(stderr, "No inputs\n");
+        return 1;
+    }
+
+    char shm_name[64];
+    snprintf(shm_name, sizeof(shm_name), "/coreaudiofuzz_persistent_%d", (int)getpid());
+    unsigned char *shm = persistent_map(shm_name, true);
+    if (shm == NULL) {
+        return 1;
+    }
+
+    uint64_t executions = 0;
+    uint64_t restarts = 0;
+    uint64_t crashes = 0;
+    uint64_t timeouts = 0;
+
+    harness_process_t harness = {start_harness(command, shm_name), 0, false};
+    double start = now_seconds();
+    double elapsed = 0;
+
+    while (elapsed < duration) {
+        for (const auto& input : inputs) {
+            *(uint32_t *)shm = (uint32_t)input.size();
+            memcpy(shm + sizeof(uint32_t), input.data(), input.size());
+
+            harness.deadline = now_seconds() + timeout;
+            harness.timed_out = false;
+            bool done = persistent_run(shm, PERSISTENT_COMMAND_RUN, harness_alive, &harness);
+            executions++;
+
+            if (!done) {
+                if (harness.timed_out) {
+                    timeouts++;
+                } else {
+                    crashes++;
+                }
+                harness.pid = start_harness(command, shm_name);
+            } else if (persistent_control(shm)->status == PERSISTENT_STATUS_RESTART) {
+                waitpid(harness.pid, NULL, 0);
+                restarts++;
+                harness.pid = start_harness(command, shm_name);
+            }
+        }
+        elapsed = now_seconds() - start;
+    }
+
+    // Let the harness exit on its own
+    harness.deadline = now_seconds() + timeout;
+    if (persistent_run(shm, PERSISTENT_COMMAND_STOP, harness_alive, &harness)) {
+        waitpid(harness.pid, NULL, 0);
+    }
+    munmap(shm, PERSISTENT_SHM_SIZE);
+    shm_unlink(shm_name);
+
+    printf("inputs:        %zu\n", inputs.size());
+    printf("executions:    %llu in %.2fs (%.0f/s)\n", (unsigned long long)executions, elapsed, executions / elapsed);
+    printf("restarts:      %llu\n", (unsigned long long)restarts);
+    printf("crashes:       %llu\n", (unsigned long long)crashes);
+    printf("timeouts:      %llu\n", (unsigned long long)timeouts);
+
+    return 0;
+}
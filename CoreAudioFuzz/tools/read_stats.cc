@@ -0,0 +1,269 @@
+/* 
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+// Prints the per routine stats (helpers/message_stats.h) of harnesses started
+// with -s name, without stopping them. Routines are sorted by the total time
+// the server spent on them.
+//
+//   ./read_stats [-w seconds] [-n rows] [-u] name
+//
+// -w prints what changed every so many seconds, until interrupted. -u removes
+// the stats page afterwards, so the next run starts from zero.
+
+#include "message_stats.h"
+
+#include <getopt.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+// A plain copy of message_stats_t, which can't be copied or subtracted
+typedef struct {
+    uint32_t index;
+    uint64_t calls;
+    uint64_t unhandled;
+    uint64_t ticks;
+    uint64_t tick_histogram[STATS_TICK_BUCKETS];
+    int32_t ret_codes[STATS_RET_CODES];
+    uint64_t ret_code_counts[STATS_RET_CODES + 1];
+    uint64_t no_ret_code;
+} routine_snapshot_t;
+
+typedef struct {
+    uint64_t inputs;
+    uint64_t unknown_ids;
+    std::vector<routine_snapshot_t> routines;
+} snapshot_t;
+
+static snapshot_t take_snapshot(const stats_page_t *page) {
+    snapshot_t snapshot;
+    snapshot.inputs = page->inputs.load(std::memory_order_relaxed);
+    snapshot.unknown_ids = page->unknown_ids.load(std::memory_order_relaxed);
+
+    for (uint32_t i = 0; i < kMessageIdCount; i++) {
+        const message_stats_t& stats = page->messages[i];
+        routine_snapshot_t routine;
+        routine.index = i;
+        routine.calls = stats.calls.load(std::memory_order_relaxed);
+        routine.unhandled = stats.unhandled.load(std::memory_order_relaxed);
+        routine.ticks = stats.ticks.load(std::memory_order_relaxed);
+        for (uint32_t j = 0; j < STATS_TICK_BUCKETS; j++) {
+            routine.tick_histogram[j] = stats.tick_histogram[j].load(std::memory_order_relaxed);
+        }
+        for (uint32_t j = 0; j < STATS_RET_CODES; j++) {
+            routine.ret_codes[j] = stats.ret_codes[j].load(std::memory_order_relaxed);
+        }
+        for (uint32_t j = 0; j <= STATS_RET_CODES; j++) {
+            routine.ret_code_counts[j] = stats.ret_code_counts[j].load(std::memory_order_relaxed);
+        }
+        routine.no_ret_code = stats.no_ret_code.load(std::memory_order_relaxed);
+        snapshot.routines.push_back(routine);
+    }
+    return snapshot;
+}
+
+// What happened between two snapshots. Return code slots are only ever
+// claimed, never given back, so they line up.
+static snapshot_t difference(const snapshot_t& now, const snapshot_t& before) {
+    snapshot_t delta = now;
+    delta.inputs -= before.inputs;
+    delta.unknown_ids -= before.unknown_ids;
+
+    for (uint32_t i = 0; i < kMessageIdCount; i++) {
+        routine_snapshot_t& routine = delta.routines[i];
+        const routine_snapshot_t& old = before.routines[i];
+        routine.calls -= old.calls;
+        routine.unhandled -= old.unhandled;
+        routine.ticks -= old.ticks;
+        for (uint32_t j = 0; j < STATS_TICK_BUCKETS; j++) {
+            routine.tick_histogram[j] -= old.tick_histogram[j];
+        }
+        for (uint32_t j = 0; j <= STATS_RET_CODES; j++) {
+            routine.ret_code_counts[j] -= old.ret_code_counts[j];
+        }
+        routine.no_ret_code -= old.no_ret_code;
+    }
+    return delta;
+}
+
+// Lower end of the bucket the given fraction of calls falls in
+static uint64_t percentile(const routine_snapshot_t& routine, double fraction) {
+    uint64_t target = (uint64_t)(routine.calls * fraction);
+    uint64_t seen = 0;
+    for (uint32_t i = 0; i < STATS_TICK_BUCKETS; i++) {
+        seen += routine.tick_histogram[i];
+        if (seen > target) {
+            return i ? 1ULL << i : 0;
+        }
+    }
+    return 1ULL << (STATS_TICK_BUCKETS - 1);
+}
+
+// FourCC error codes ('!obj') as text, the rest as numbers
+static const char *ret_code_to_string(int32_t ret_code, char *buffer, size_t size) {
+    char chars[4] = {(char)(ret_code >> 24), (char)(ret_code >> 16), (char)(ret_code >> 8), (char)ret_code};
+    bool printable = std::all_of(chars, chars + 4, [](char c) { return c >= 0x20 && c < 0x7f; });
+    if (printable) {
+        snprintf(buffer, size, "'%.4s'", chars);
+    } else {
+        snprintf(buffer, size, "%d", ret_code);
+    }
+    return buffer;
+}
+
+static void print_ret_codes(const routine_snapshot_t& routine) {
+    std::vector<std::pair<uint64_t, int32_t>> codes;
+    for (uint32_t j = 0; j < STATS_RET_CODES; j++) {
+        if (routine.ret_code_counts[j]) {
+            codes.push_back({routine.ret_code_counts[j], routine.ret_codes[j]});
+        }
+    }
+    std::sort(codes.rbegin(), codes.rend());
+
+    char buffer[16];
+    for (size_t j = 0; j < codes.size() && j < 3; j++) {
+        printf(" %s %.0f%%", ret_code_to_string(codes[j].second, buffer, sizeof(buffer)),
+               100.0 * codes[j].first / routine.calls);
+    }
+    if (routine.ret_code_counts[STATS_RET_CODES]) {
+        printf(" other %.0f%%", 100.0 * routine.ret_code_counts[STATS_RET_CODES] / routine.calls);
+    }
+    if (routine.no_ret_code) {
+        printf(" none %.0f%%", 100.0 * routine.no_ret_code / routine.calls);
+    }
+}
+
+// Times are in ticks of whatever stats_clock() read. Neither counter counts
+// CPU cycles: the TSC runs at a fixed reference rate, and the arm64 generic
+// timer far slower than the cores (24 MHz, about 41.7 ns a tick, on Apple
+// silicon).
+static void print_clock(uint32_t clock) {
+    uint64_t frequency = clock == STATS_CLOCK ? stats_clock_frequency() : 0;
+    const char *name = clock == STATS_CLOCK_TSC ? "x86_64 time stamp counter" :
+                       clock == STATS_CLOCK_CNTVCT ? "arm64 generic timer (cntvct_el0)" : "clock_gettime";
+    if (frequency && clock != STATS_CLOCK_NS) {
+        printf("clock: %s, %.3f MHz, %.2f ns per tick\n", name, frequency / 1e6, 1e9 / frequency);
+    } else {
+        printf("clock: %s\n", name);
+    }
+}
+
+static void print_snapshot(const snapshot_t& snapshot, const char *units, size_t rows) {
+    std::vector<routine_snapshot_t> routines = snapshot.routines;
+    std::sort(routines.begin(), routines.end(), [](const routine_snapshot_t& a, const routine_snapshot_t& b) {
+        return a.ticks > b.ticks;
+    });
+
+    uint64_t calls = 0, ticks = 0;
+    for (const routine_snapshot_t& routine : routines) {
+        calls += routine.calls;
+        ticks += routine.ticks;
+    }
+
+    printf("inputs: %llu  messages: %llu  unknown IDs: %llu  %s: %llu\n",
+           (unsigned long long)snapshot.inputs, (unsigned long long)calls,
+           (unsigned long long)snapshot.unknown_ids, units, (unsigned long long)ticks);
+    int width = 0;
+    for (size_t i = 0; i < routines.size() && i < rows && routines[i].calls; i++) {
+        int length = strlen(message_id_to_string(static_cast<message_id_enum>(kFirstMessageId + routines[i].index)));
+        width = std::max(width, length);
+    }
+
+    printf("%-*s %10s %6s %6s %10s %10s %10s  %s\n", width, "routine", "calls", "calls%", "time%",
+           "mean", "p50", "p99", "return codes");
+
+    for (size_t i = 0; i < routines.size() && i < rows; i++) {
+        const routine_snapshot_t& routine = routines[i];
+        if (!routine.calls) {
+            break;
+        }
+
+        printf("%-*s %10llu %6.2f %6.2f %10llu %10llu %10llu ", width,
+               message_id_to_string(static_cast<message_id_enum>(kFirstMessageId + routine.index)),
+               (unsigned long long)routine.calls, 100.0 * routine.calls / calls,
+               ticks ? 100.0 * routine.ticks / ticks : 0.0,
+               (unsigned long long)(routine.ticks / routine.calls),
+               (unsigned long long)percentile(routine, 0.5), (unsigned long long)percentile(routine, 0.99));
+        print_ret_codes(routine);
+        if (routine.unhandled) {
+            printf(" (%llu unhandled)", (unsigned long long)routine.unhandled);
+        }
+        printf("\n");
+    }
+
+    uint32_t never_sent = std::count_if(routines.begin(), routines.end(),
+                                        [](const routine_snapshot_t& routine) { return routine.calls == 0; });
+    printf("%u of %u routines not sent\n", never_sent, kMessageIdCount);
+}
+
+int main(int argc, char *argv[]) {
+    unsigned watch = 0;
+    size_t rows = kMessageIdCount;
+    bool unlink_page = false;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "w:n:u")) != -1) {
+        switch (opt) {
+            case 'w':
+                watch = strtoul(optarg, NULL, 0);
+                break;
+            case 'n':
+                rows = strtoul(optarg, NULL, 0);
+                break;
+            case 'u':
+                unlink_page = true;
+                break;
+            default:
+                fprintf(stderr, "Usage: %s [-w seconds] [-n rows] [-u] name\n", argv[0]);
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    if (optind != argc - 1) {
+        fprintf(stderr, "Usage: %s [-w seconds] [-n rows] [-u] name\n", argv[0]);
+        exit(EXIT_FAILURE);
+    }
+    const char *name = argv[optind];
+
+    const stats_page_t *page = message_stats_open(name);
+    if (!page) {
+        fprintf(stderr, "No stats page %s from this build of the harness\n", name);
+        return 1;
+    }
+
+    const char *units = page->clock == STATS_CLOCK_NS ? "ns" : "counter ticks";
+    print_clock(page->clock);
+    snapshot_t snapshot = take_snapshot(page);
+    print_snapshot(snapshot, units, rows);
+
+    while (watch) {
+        sleep(watch);
+        snapshot_t next = take_snapshot(page);
+        printf("\n--- last %u s ---\n", watch);
+        print_snapshot(difference(next, snapshot), units, rows);
+        fflush(stdout);
+        snapshot = next;
+    }
+
+    if (unlink_page && shm_unlink(name) == -1) {
+        perror("Error in shm_unlink");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,50 @@
+/* 
+Copyright 2025 Google LLC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    https://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef TOOL_UTIL_H
+#define TOOL_UTIL_H
+
+#include "harness.h"
+
+#include <stdio.h>
+#include <time.h>
+
+#include <vector>
+
+// Helpers shared by the host tools
+
+inline double now_seconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Reads up to MAX_SAMPLE_SIZE bytes of a sample, the most the harness takes
+inline bool read_sample(const char *file_path, std::vector<uint8_t>& sample) {
+    FILE *file = fopen(file_path, "rb");
+    if (!file) {
+        perror(file_path);
+        return false;
+    }
+
+    sample.resize(MAX_SAMPLE_SIZE);
+    size_t size = fread(sample.data(), 1, MAX_SAMPLE_SIZE, file);
+    sample.resize(size);
+    fclose(file);
+    return true;
+}
+
+#endif // TOOL_UTIL_H
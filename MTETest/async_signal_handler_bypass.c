@@ -27,34 +27,11 @@
 #include <malloc.h>
 
 #include "lib/mte.h"
+#include "lib/persistent.h"
 #include "lib/scheduler.h"
 
 #include "duktape.h"
 
-static void* read_file(const char* path) {
-  int fd = open(path, O_RDONLY);
-  size_t data_read = 0;
-  size_t data_size = 0;
-  char* data = NULL;
-  while (true) {
-    if (data_read == data_size) {
-      char* new_data = realloc(data, data_size + 1024);
-      if (!new_data) {
-        free(data);
-        return NULL;
-      }
-      data = new_data;
-      data_size = data_size + 1024;
-    }
-    ssize_t result = read(fd, &data[data_read], data_size - data_read);
-    if (result <= 0) {
-      return data;
-    } else {
-      data_read += result;
-    }
-  }
-}
-
 static duk_ret_t print(duk_context *ctx) {
   fprintf(stderr, "%s\n", duk_to_string(ctx, 0));
   return 0;
@@ -77,7 +54,8 @@ static duk_ret_t tag_check_fail(duk_context* ctx) {
   void* ptr = mmap(0, 0x1000, PROT_READ | PROT_WRITE | PROT_MTE,
     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
   mte_tag_and_zero(ptr, 0x1000);
-  *(char*)ptr = 0x23;
+  persistent_trigger();
+  mte_store8(ptr, 0x23);
   return 0;
 }
 
@@ -101,10 +79,37 @@ void add_segv_handler() {
   assert(0 == sigaction(SIGSEGV, &new_segv_handler, &old_segv_handler));
 }
 
+// Runs the script compiled for variant, which is at that index on the value
+// stack, in a child process forked by run_persistent.
+static bool run_script(size_t variant, void* arg) {
+  duk_context* ctx = arg;
+  g_first_chance_handler = NULL;
+  duk_dup(ctx, (duk_idx_t)variant);
+  return duk_pcall(ctx, 0) == DUK_EXEC_SUCCESS;
+}
+
+static void usage() {
+  fprintf(stderr, "usage: async_signal_handler_bypass [-p iterations] exploit_javascript...\n");
+  fprintf(stderr, "  -p runs each script iterations times in a persistent process, and reports\n");
+  fprintf(stderr, "     the bypass rate and time to bypass\n");
+  exit(-1);
+}
+
 int main(int argc, char** argv) {
-  if (argc != 2) {
-    fprintf(stderr, "usage: async_signal_handler_bypass exploit_javascript\n");
-    exit(-1);
+  size_t iterations = 0;
+  int opt;
+  while ((opt = getopt(argc, argv, "p:")) != -1) {
+    switch (opt) {
+      case 'p':
+        iterations = strtoull(optarg, NULL, 0);
+        break;
+      default:
+        usage();
+    }
+  }
+  size_t script_count = argc - optind;
+  if (!script_count || (!iterations && script_count != 1)) {
+    usage();
   }
 
   g_first_chance_handler = NULL;
@@ -126,11 +131,6 @@ int main(int argc, char** argv) {
            (void*)((uintptr_t)print - (uintptr_t)elf_base_ptr),
            (void*)((uintptr_t)&g_first_chance_handler - (uintptr_t)elf_base_ptr));
 
-  char* script = read_file(argv[1]);
-
-  char* full_script;
-  asprintf(&full_script, "%s\n%s", offsets, script);
-
   duk_context *ctx = duk_create_heap_default();
 
   duk_push_c_function(ctx, print, 1);
@@ -142,10 +142,30 @@ int main(int argc, char** argv) {
   duk_push_c_function(ctx, corrupt_bytearray, 1);
   duk_put_global_string(ctx, "corrupt_bytearray");
 
-  duk_eval_string_noresult(ctx, full_script);
+  for (size_t i = 0; i < script_count; ++i) {
+    char* script = read_file(argv[optind + i]);
+    assert(script);
+
+    char* full_script;
+    asprintf(&full_script, "%s\n%s", offsets, script);
+
+    if (!iterations) {
+      duk_eval_string_noresult(ctx, full_script);
+    } else if (duk_pcompile_string(ctx, 0, full_script)) {
+      fprintf(stderr, "%s: %s\n", argv[optind + i], duk_safe_to_string(ctx, -1));
+      exit(-1);
+    }
+    free(full_script);
+    free(script);
+  }
+
+  if (iterations) {
+    run_persistent(iterations, script_count, &argv[optind], run_script, ctx);
+  }
+
   duk_destroy_heap(ctx);
 
   fprintf(stderr, "done\n");
 
   return 0;
-}
\ No newline at end of file
+}
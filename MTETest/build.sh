@@ -16,12 +16,13 @@
 
 export ADB_PATH=adb
 export CLANG_PATH=/ssd/llvm/build/bin/clang
+export HOST_CC=cc
 export CFLAGS='--target=aarch64-linux -march=armv8a+memtag -std=gnu99 -O2 -Wall -Wextra -I./'
 export LDFLAGS='-lpthread -lm -fuse-ld=lld -static'
 
 # Build ./lib
-$CLANG_PATH $CFLAGS -c ./lib/histogram.c ./lib/mte.c ./lib/perf_counters.c ./lib/scheduler.c ./lib/timer.c
-export SHARED_OBJECTS='./histogram.o ./mte.o ./perf_counters.o ./scheduler.o ./timer.o'
+$CLANG_PATH $CFLAGS -c ./lib/classifier.c ./lib/distribution.c ./lib/environment.c ./lib/histogram.c ./lib/mte.c ./lib/mte_emulation.c ./lib/noise.c ./lib/perf_counters.c ./lib/persistent.c ./lib/results.c ./lib/scheduler.c ./lib/timer.c ./lib/tuning.c ./lib/workers.c
+export SHARED_OBJECTS='./classifier.o ./distribution.o ./environment.o ./histogram.o ./mte.o ./mte_emulation.o ./noise.o ./perf_counters.o ./persistent.o ./results.o ./scheduler.o ./timer.o ./tuning.o ./workers.o'
 
 # Build duktape library
 wget https://duktape.org/duktape-2.7.0.tar.xz
@@ -37,6 +38,24 @@ $CLANG_PATH $CFLAGS $LDFLAGS ./speculation_window.c $SHARED_OBJECTS -o speculati
 $CLANG_PATH $CFLAGS $LDFLAGS ./async_signal_handler_bypass.c $SHARED_OBJECTS $DUKTAPE_OBJECTS -I$DUKTAPE_INCLUDE_PATH -o async_signal_handler_bypass
 $CLANG_PATH $CFLAGS $LDFLAGS ./async_thread_bypass.c $SHARED_OBJECTS $DUKTAPE_OBJECTS -I$DUKTAPE_INCLUDE_PATH -o async_thread_bypass
 
+# Build host tools
+export HOST_CFLAGS='-std=gnu99 -O2 -Wall -Wextra -I./'
+export HOST_LIB_SOURCES='./lib/classifier.c ./lib/distribution.c ./lib/environment.c ./lib/histogram.c ./lib/mte.c ./lib/mte_emulation.c ./lib/noise.c ./lib/perf_counters.c ./lib/persistent.c ./lib/results.c ./lib/scheduler.c ./lib/timer.c ./lib/tuning.c ./lib/workers.c'
+$HOST_CC $HOST_CFLAGS ./results_convert.c ./lib/results.c -o results_convert
+$HOST_CC $HOST_CFLAGS ./results_summary.c ./lib/distribution.c ./lib/results.c -o results_summary
+
+# Build a host (eg. x86_64) version of speculation_window, for validating the
+# harness and comparing speculation windows without MTE
+$HOST_CC $HOST_CFLAGS ./speculation_window.c $HOST_LIB_SOURCES -lpthread -lm -o speculation_window_host
+
+# Build host versions of the other tests, which use software MTE emulation (see
+# lib/mte_emulation.c)
+$HOST_CC $HOST_CFLAGS -c ./duktape-2.7.0/src/duktape.c -o duktape_host.o
+$HOST_CC $HOST_CFLAGS ./software_issue_1.c $HOST_LIB_SOURCES -lpthread -lm -o software_issue_1_host
+$HOST_CC $HOST_CFLAGS ./software_issue_2.c $HOST_LIB_SOURCES -lpthread -lm -o software_issue_2_host
+$HOST_CC $HOST_CFLAGS ./async_signal_handler_bypass.c $HOST_LIB_SOURCES ./duktape_host.o -I$DUKTAPE_INCLUDE_PATH -lpthread -lm -o async_signal_handler_bypass_host
+$HOST_CC $HOST_CFLAGS ./async_thread_bypass.c $HOST_LIB_SOURCES ./duktape_host.o -I$DUKTAPE_INCLUDE_PATH -lpthread -lm -o async_thread_bypass_host
+
 # Push all needed files to device
 $ADB_PATH push ./software_issue_1 /data/local/tmp/software_issue_1
 $ADB_PATH push ./software_issue_2 /data/local/tmp/software_issue_2
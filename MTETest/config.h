@@ -32,14 +32,64 @@
 
 #if TIMER == SHARED_MEMORY_TIMER
 // CPU core to use for running the shared memory timer thread. This should not
-// collide with the core being tested!
-#define SHARED_MEMORY_TIMER_CPU 1
+// collide with the core being tested! Set this to -1 to have start_timer choose
+// a spare core near the core being tested from the CPU topology.
+#define SHARED_MEMORY_TIMER_CPU (-1)
+// Maximum number of independent counters, for tests that take measurements from
+// several threads at once. Each counter thread needs a core of its own.
+#define SHARED_MEMORY_TIMER_COUNTERS (4)
 // This should be calculated for the CPU under test using calibrate_timer
 #endif
 
 // This may need adjusting depending on the branch predictor behaviour of the
-// CPU you are using.
+// CPU you are using. speculation_window -T measures the smallest number of
+// iterations after which the test branch is mispredicted at least
+// BRANCH_PREDICTOR_TUNING_TARGET of the time, and saves it for the core type to
+// BRANCH_PREDICTOR_TUNING_PATH (or the file given with -t), which is then used
+// instead of this default.
 #define BRANCH_PREDICTOR_ITERATIONS (512)
+#if defined(__aarch64__)
+#define BRANCH_PREDICTOR_TUNING_PATH "/data/local/tmp/branch_predictor_iterations"
+#else
+#define BRANCH_PREDICTOR_TUNING_PATH "branch_predictor_iterations"
+#endif
+#define BRANCH_PREDICTOR_TUNING_TARGET (0.95)
+#define BRANCH_PREDICTOR_TUNING_MAX (4096)
+
+// Adaptive sampling configuration (speculation_window -a). Tests are run in
+// batches of ADAPTIVE_BATCH_SIZE, after which each configuration is classified
+// and dropped once the confidence level is reached. Fractions of fast samples
+// within ADAPTIVE_TOLERANCE of each other are considered to be the same.
+#define ADAPTIVE_BATCH_SIZE (256)
+#define ADAPTIVE_MIN_SAMPLES (32)
+#define ADAPTIVE_TOLERANCE (0.1)
+
+// Calibration (speculation_window -C) runs this many tests each with the timing
+// load known to be cached and known to be uncached.
+#define CALIBRATION_ITERATIONS ((size_t)1024)
+
+// Noise detection (speculation_window -n). Disturbances are checked for around
+// each batch of NOISE_BATCH_SIZE tests, so this should be small enough that
+// most batches fit between context switches. Discarded batches are rerun.
+#define NOISE_BATCH_SIZE ((size_t)8)
+
+// Hardened mode (speculation_window -H) runs tests with SCHED_FIFO priority,
+// which a watchdog drops again after this long.
+#define HARDEN_WATCHDOG_SECONDS (60)
+
+// Use software MTE emulation (lib/mte_emulation.c) when building for aarch64,
+// for comparison with hardware MTE. Emulation is always used on other
+// architectures.
+//#define MTE_EMULATION
+
+// In emulated async mode, tag check faults are reported on the next system call
+// made through mte_syscall_ptr, or after this long (approximating the next
+// timer tick).
+#define MTE_EMULATION_ASYNC_DELAY_US (4000)
+
+// Persistent mode for the async bypass harnesses (-p). Iterations that neither
+// bypass MTE nor get caught within this long are killed.
+#define PERSISTENT_TIMEOUT_MS (1000)
 
 // Print histograms to visualize the results of each testcase.
 //#define PRINT_HISTOGRAM
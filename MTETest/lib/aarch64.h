@@ -58,4 +58,11 @@ inline uint64_t virtual_count() {
   return count;
 }
 
+__attribute__((always_inline))
+inline uint64_t virtual_frequency() {
+  uint64_t frequency;
+  asm volatile ("mrs %0, cntfrq_el0\n":"=r"(frequency)::);
+  return frequency;
+}
+
 #endif // AARCH64_H_
@@ -0,0 +1,30 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ARCH_H_
+#define ARCH_H_
+
+// Cache maintenance, barriers and the virtual counter for the architecture
+// being built for. Each architecture header provides the same functions, so
+// that the test harness can also be run and compared on x86_64 machines.
+
+#if defined(__aarch64__)
+#include "aarch64.h"
+#elif defined(__x86_64__)
+#include "x86_64.h"
+#else
+#error "unsupported architecture"
+#endif
+
+#endif // ARCH_H_
@@ -0,0 +1,91 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "classifier.h"
+
+#include <assert.h>
+#include <math.h>
+
+void classifier_init(classifier_t* classifier, double confidence,
+                     double tolerance, uint64_t min_samples) {
+  assert(0.0 < confidence && confidence < 1.0);
+
+  // Find z such that P(|Z| > z) = 1 - confidence for a standard normal Z.
+  double lower = 0.0;
+  double upper = 10.0;
+  for (int i = 0; i < 64; ++i) {
+    double z = (lower + upper) / 2.0;
+    if (erfc(z / sqrt(2.0)) > 1.0 - confidence) {
+      lower = z;
+    } else {
+      upper = z;
+    }
+  }
+
+  classifier->threshold = 0;
+  classifier->z = (lower + upper) / 2.0;
+  classifier->tolerance = tolerance;
+  classifier->min_samples = min_samples;
+}
+
+void wilson_interval(uint64_t successes, uint64_t total, double z,
+                     double* lower, double* upper) {
+  if (!total) {
+    *lower = 0.0;
+    *upper = 1.0;
+    return;
+  }
+
+  double n = (double)total;
+  double p = (double)successes / n;
+  double z2 = z * z;
+  double centre = (p + z2 / (2.0 * n)) / (1.0 + z2 / n);
+  double radius = (z / (1.0 + z2 / n)) * sqrt(p * (1.0 - p) / n + z2 / (4.0 * n * n));
+  *lower = fmax(0.0, centre - radius);
+  *upper = fmin(1.0, centre + radius);
+}
+
+classification_t classify(const classifier_t* classifier,
+                          const distribution_t* lhs, const distribution_t* rhs) {
+  if (lhs->total < classifier->min_samples || rhs->total < classifier->min_samples) {
+    return CLASSIFICATION_UNDECIDED;
+  }
+
+  double lhs_lower, lhs_upper, rhs_lower, rhs_upper;
+  wilson_interval(distribution_count_below(lhs, classifier->threshold), lhs->total,
+                  classifier->z, &lhs_lower, &lhs_upper);
+  wilson_interval(distribution_count_below(rhs, classifier->threshold), rhs->total,
+                  classifier->z, &rhs_lower, &rhs_upper);
+
+  if (lhs_lower > rhs_upper || rhs_lower > lhs_upper) {
+    return CLASSIFICATION_DIFFERENT;
+  }
+
+  if (fmax(lhs_upper - rhs_lower, rhs_upper - lhs_lower) < classifier->tolerance) {
+    return CLASSIFICATION_SAME;
+  }
+
+  return CLASSIFICATION_UNDECIDED;
+}
+
+const char* classification_name(classification_t classification) {
+  switch (classification) {
+    case CLASSIFICATION_SAME:
+      return "same";
+    case CLASSIFICATION_DIFFERENT:
+      return "different";
+    default:
+      return "undecided";
+  }
+}
@@ -0,0 +1,60 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef CLASSIFIER_H_
+#define CLASSIFIER_H_
+
+#include "config.h"
+#include "distribution.h"
+
+// Sequential classification of whether two latency distributions differ, for
+// deciding when a test has taken enough samples. Each sample is counted as fast
+// or slow against a threshold, and the fractions of fast samples in the two
+// distributions are compared using Wilson score confidence intervals.
+//
+// Classifying again after every batch of samples means that the effective
+// confidence is somewhat lower than the one requested, so be conservative.
+
+typedef enum {
+  CLASSIFICATION_UNDECIDED,
+  // The fractions of fast samples are within tolerance of each other.
+  CLASSIFICATION_SAME,
+  // The fractions of fast samples differ.
+  CLASSIFICATION_DIFFERENT,
+} classification_t;
+
+typedef struct {
+  // Samples below this latency are fast.
+  uint64_t threshold;
+  // Two-sided critical value for the requested confidence.
+  double z;
+  // Largest difference between the fractions of fast samples that still counts
+  // as the same.
+  double tolerance;
+  // Number of samples needed in each distribution before deciding.
+  uint64_t min_samples;
+} classifier_t;
+
+void classifier_init(classifier_t* classifier, double confidence,
+                     double tolerance, uint64_t min_samples);
+
+void wilson_interval(uint64_t successes, uint64_t total, double z,
+                     double* lower, double* upper);
+
+classification_t classify(const classifier_t* classifier,
+                          const distribution_t* lhs, const distribution_t* rhs);
+
+const char* classification_name(classification_t classification);
+
+#endif // CLASSIFIER_H_
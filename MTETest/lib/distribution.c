@@ -0,0 +1,138 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "distribution.h"
+
+#include <string.h>
+
+void distribution_reset(distribution_t* distribution) {
+  memset(distribution, 0, sizeof(*distribution));
+}
+
+void distribution_merge(distribution_t* distribution, const distribution_t* other) {
+  for (size_t i = 0; i < DISTRIBUTION_BINS; ++i) {
+    distribution->counts[i] += other->counts[i];
+  }
+  distribution->total += other->total;
+}
+
+uint64_t distribution_percentile(const distribution_t* distribution, unsigned percentile) {
+  uint64_t target = (distribution->total * percentile) / 100;
+  uint64_t count = 0;
+  for (size_t i = 0; i < DISTRIBUTION_BINS; ++i) {
+    count += distribution->counts[i];
+    if (count > target) {
+      return i;
+    }
+  }
+  return DISTRIBUTION_BINS - 1;
+}
+
+uint64_t distribution_count_below(const distribution_t* distribution, uint64_t threshold) {
+  uint64_t count = 0;
+  for (size_t i = 0; i < threshold && i < DISTRIBUTION_BINS; ++i) {
+    count += distribution->counts[i];
+  }
+  return count;
+}
+
+double distribution_fraction_below(const distribution_t* distribution, uint64_t threshold) {
+  if (!distribution->total) {
+    return 0.0;
+  }
+  return (double)distribution_count_below(distribution, threshold)
+         / (double)distribution->total;
+}
+
+uint64_t distribution_split(const distribution_t* distribution) {
+  double total_sum = 0.0;
+  for (size_t i = 0; i < DISTRIBUTION_BINS; ++i) {
+    total_sum += (double)i * (double)distribution->counts[i];
+  }
+
+  // Maximising the variance between the classes is equivalent to minimising
+  // the variance within them, and can be done in a single pass.
+  uint64_t best_threshold = 0;
+  double best_variance = 0.0;
+  uint64_t fast_count = 0;
+  double fast_sum = 0.0;
+  for (size_t i = 0; i < DISTRIBUTION_BINS; ++i) {
+    fast_count += distribution->counts[i];
+    fast_sum += (double)i * (double)distribution->counts[i];
+    uint64_t slow_count = distribution->total - fast_count;
+    if (!fast_count || !slow_count) {
+      continue;
+    }
+    double difference = fast_sum / (double)fast_count
+                        - (total_sum - fast_sum) / (double)slow_count;
+    double variance = (double)fast_count * (double)slow_count
+                      * difference * difference;
+    if (variance > best_variance) {
+      best_variance = variance;
+      best_threshold = i + 1;
+    }
+  }
+  return best_threshold;
+}
+
+uint64_t distribution_separate(const distribution_t* fast, const distribution_t* slow) {
+  if (!fast->total || !slow->total) {
+    return 0;
+  }
+  // With the threshold at i, fast samples at or above i and slow samples below
+  // i are misclassified.
+  uint64_t fast_below = 0;
+  uint64_t slow_below = 0;
+  double best_error = 2.0;
+  uint64_t best_start = 0;
+  uint64_t best_end = 0;
+  for (size_t i = 0; i <= DISTRIBUTION_BINS; ++i) {
+    double error = (double)(fast->total - fast_below) / (double)fast->total
+                   + (double)slow_below / (double)slow->total;
+    if (error < best_error) {
+      best_error = error;
+      best_start = i;
+      best_end = i;
+    } else if (error == best_error && best_end == i - 1) {
+      best_end = i;
+    }
+    if (i < DISTRIBUTION_BINS) {
+      fast_below += fast->counts[i];
+      slow_below += slow->counts[i];
+    }
+  }
+  return best_start + (best_end - best_start) / 2;
+}
+
+double distribution_distance(const distribution_t* lhs, const distribution_t* rhs) {
+  if (!lhs->total || !rhs->total) {
+    return 0.0;
+  }
+  uint64_t lhs_count = 0;
+  uint64_t rhs_count = 0;
+  double distance = 0.0;
+  for (size_t i = 0; i < DISTRIBUTION_BINS; ++i) {
+    lhs_count += lhs->counts[i];
+    rhs_count += rhs->counts[i];
+    double difference = (double)lhs_count / (double)lhs->total
+                        - (double)rhs_count / (double)rhs->total;
+    if (difference < 0) {
+      difference = -difference;
+    }
+    if (difference > distance) {
+      distance = difference;
+    }
+  }
+  return distance;
+}
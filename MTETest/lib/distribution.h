@@ -0,0 +1,59 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DISTRIBUTION_H_
+#define DISTRIBUTION_H_
+
+#include "config.h"
+
+// Latency distributions, counted in bins of one timer tick. Unlike histogram_t
+// these keep every sample, so they can be merged across workers and compared
+// against each other. Anything beyond the last bin is counted in the last bin.
+
+#define DISTRIBUTION_BINS ((size_t)1024)
+
+typedef struct {
+  uint64_t counts[DISTRIBUTION_BINS];
+  uint64_t total;
+} distribution_t;
+
+void distribution_reset(distribution_t* distribution);
+void distribution_merge(distribution_t* distribution, const distribution_t* other);
+uint64_t distribution_percentile(const distribution_t* distribution, unsigned percentile);
+
+// Number and fraction of samples below threshold.
+uint64_t distribution_count_below(const distribution_t* distribution, uint64_t threshold);
+double distribution_fraction_below(const distribution_t* distribution, uint64_t threshold);
+
+// Threshold that best splits a bimodal distribution (eg. cached and uncached
+// loads) into two classes, chosen to minimise the variance within each class
+// (Otsu's method). Samples below the threshold fall into the fast class.
+uint64_t distribution_split(const distribution_t* distribution);
+
+// Threshold that best separates samples known to be fast (eg. cached loads)
+// from samples known to be slow, minimising the fraction of each that would be
+// misclassified. Ties are broken by taking the middle of the best range.
+uint64_t distribution_separate(const distribution_t* fast, const distribution_t* slow);
+
+// Kolmogorov-Smirnov distance between two distributions, ie. the largest
+// difference between their cumulative distribution functions, in [0, 1].
+double distribution_distance(const distribution_t* lhs, const distribution_t* rhs);
+
+__attribute__((always_inline))
+static inline void distribution_add(distribution_t* distribution, uint64_t value) {
+  distribution->counts[value < DISTRIBUTION_BINS ? value : DISTRIBUTION_BINS - 1] += 1;
+  distribution->total += 1;
+}
+
+#endif // DISTRIBUTION_H_
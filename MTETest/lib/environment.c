@@ -0,0 +1,157 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "environment.h"
+
+#include <assert.h>
+#include <sched.h>
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "scheduler.h"
+
+#define STACK_PREFAULT_SIZE ((size_t)0x10000)
+
+static bool hardened = false;
+static bool use_huge_pages = false;
+static volatile sig_atomic_t realtime = false;
+static volatile sig_atomic_t demoted = false;
+static bool memory_locked = false;
+static size_t hugetlb_mappings = 0;
+static size_t thp_mappings = 0;
+
+static void watchdog_handler(int signal) {
+  (void)signal;
+  struct sched_param param = {0};
+  sched_setscheduler(0, SCHED_OTHER, &param);
+  realtime = false;
+  demoted = true;
+  const char message[] = "watchdog: dropped SCHED_FIFO priority\n";
+  write(STDERR_FILENO, message, sizeof(message) - 1);
+}
+
+__attribute__((noinline))
+static void prefault_stack() {
+  volatile char stack[STACK_PREFAULT_SIZE];
+  for (size_t i = 0; i < sizeof(stack); i += 0x1000) {
+    stack[i] = 0;
+  }
+}
+
+void harden_environment(bool huge_pages) {
+  hardened = true;
+  use_huge_pages = huge_pages;
+
+  prefault_stack();
+  memory_locked = !mlockall(MCL_CURRENT|MCL_FUTURE);
+
+  struct sched_param param = {sched_get_priority_max(SCHED_FIFO)};
+  if (!sched_setscheduler(0, SCHED_FIFO, &param)) {
+    realtime = true;
+    signal(SIGALRM, watchdog_handler);
+    alarm(HARDEN_WATCHDOG_SECONDS);
+  }
+}
+
+void* map_memory(size_t size, int prot) {
+  int flags = MAP_ANONYMOUS|MAP_PRIVATE;
+  if (hardened) {
+    flags |= MAP_POPULATE;
+  }
+  if (!use_huge_pages) {
+    void* ptr = mmap(NULL, size, prot, flags, -1, 0);
+    assert(ptr != MAP_FAILED);
+    return ptr;
+  }
+
+  size_t huge_size = (size + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+  void* ptr = mmap(NULL, huge_size, prot, flags|MAP_HUGETLB, -1, 0);
+  if (ptr != MAP_FAILED) {
+    hugetlb_mappings += 1;
+    return ptr;
+  }
+
+  // No hugetlbfs pages (or not with these protections), so fall back to an
+  // aligned mapping that transparent huge pages can back.
+  char* mapping = mmap(NULL, huge_size + HUGE_PAGE_SIZE, prot,
+                       flags & ~MAP_POPULATE, -1, 0);
+  assert(mapping != MAP_FAILED);
+  char* aligned = (char*)(((uintptr_t)mapping + HUGE_PAGE_SIZE - 1)
+                          & ~(uintptr_t)(HUGE_PAGE_SIZE - 1));
+  if (aligned != mapping) {
+    munmap(mapping, aligned - mapping);
+  }
+  munmap(aligned + huge_size, mapping + HUGE_PAGE_SIZE - aligned);
+  if (!madvise(aligned, huge_size, MADV_HUGEPAGE)) {
+    thp_mappings += 1;
+  }
+  if (hardened) {
+    for (size_t i = 0; i < huge_size; i += 0x1000) {
+      ((volatile char*)aligned)[i] = 0;
+    }
+  }
+  return aligned;
+}
+
+bool environment_demoted() {
+  return demoted;
+}
+
+static void read_sysfs_string(const char* path, char* value, size_t size) {
+  snprintf(value, size, "unknown");
+  FILE* file = fopen(path, "r");
+  if (file) {
+    if (fgets(value, size, file)) {
+      value[strcspn(value, "\n")] = '\0';
+    }
+    fclose(file);
+  }
+}
+
+static bool cpu_in_sysfs_list(const char* path, int cpu) {
+  char list[256];
+  read_sysfs_string(path, list, sizeof(list));
+  int cores[CPU_SETSIZE];
+  size_t count = cpu_parse_list(list, cores, CPU_SETSIZE);
+  for (size_t i = 0; i < count; ++i) {
+    if (cores[i] == cpu) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void print_environment(int cpu) {
+  char path[128];
+  char governor[64];
+  snprintf(path, sizeof(path),
+           "/sys/devices/system/cpu/cpu%i/cpufreq/scaling_governor", cpu);
+  read_sysfs_string(path, governor, sizeof(governor));
+
+  const char* huge_pages = "off";
+  if (use_huge_pages) {
+    huge_pages = thp_mappings ? (hugetlb_mappings ? "hugetlb+thp" : "thp")
+                              : (hugetlb_mappings ? "hugetlb" : "no");
+  }
+
+  fprintf(stderr, "environment: cpu %i, SCHED_FIFO %s, mlockall %s, huge pages %s, "
+                  "governor %s, isolated %s, nohz_full %s\n",
+          cpu, !hardened ? "off" : realtime ? "yes" : demoted ? "dropped" : "no",
+          !hardened ? "off" : memory_locked ? "yes" : "no", huge_pages, governor,
+          cpu_in_sysfs_list("/sys/devices/system/cpu/isolated", cpu) ? "yes" : "no",
+          cpu_in_sysfs_list("/sys/devices/system/cpu/nohz_full", cpu) ? "yes" : "no");
+}
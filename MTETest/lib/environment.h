@@ -0,0 +1,43 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef ENVIRONMENT_H_
+#define ENVIRONMENT_H_
+
+#include "config.h"
+
+// Opt-in hardening of the test process against scheduling and paging noise:
+// SCHED_FIFO priority (with a watchdog that drops it again after
+// HARDEN_WATCHDOG_SECONDS, in case a test never yields), locked and prefaulted
+// memory, and optionally huge pages for test buffers. None of these are
+// guaranteed to be available, so print_environment reports which ones were
+// actually obtained, along with the cpufreq governor and isolation state of
+// the core, so that results from different machines can be compared.
+
+#define HUGE_PAGE_SIZE ((size_t)0x200000)
+
+// Call after pinning to the core under test.
+void harden_environment(bool huge_pages);
+
+// Maps anonymous memory for test buffers, prefaulted and backed by huge pages
+// when requested.
+void* map_memory(size_t size, int prot);
+
+// Whether the watchdog has dropped SCHED_FIFO priority, so that the samples
+// taken since then ran under normal scheduling.
+bool environment_demoted();
+
+void print_environment(int cpu);
+
+#endif // ENVIRONMENT_H_
@@ -16,6 +16,8 @@
 
 #include <sys/prctl.h>
 
+// With MTE_EMULATION, mte_enable and mte_disable are in lib/mte_emulation.c.
+#if !defined(MTE_EMULATION)
 void mte_enable(bool sync, uint16_t tag_mask) {
   int ctrl = PR_TAGGED_ADDR_ENABLE | (sync ? PR_MTE_TCF_SYNC : PR_MTE_TCF_ASYNC);
   ctrl |= tag_mask << PR_MTE_TAG_SHIFT;
@@ -25,3 +27,4 @@ void mte_enable(bool sync, uint16_t tag_mask) {
 void mte_disable() {
   assert(0 == prctl(PR_SET_TAGGED_ADDR_CTRL, PR_MTE_TCF_NONE, 0, 0, 0));
 }
+#endif
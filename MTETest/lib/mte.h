@@ -15,17 +15,67 @@
 #ifndef MTE_H_
 #define MTE_H_
 
+#include "config.h"
+
 #include <assert.h>
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 #include <sys/mman.h>
 #include <sys/prctl.h>
 
+#if !defined(__aarch64__) && !defined(MTE_EMULATION)
+#define MTE_EMULATION
+#endif
+
 #define DEFAULT_TAG_MASK ((uint16_t)0xfffe)
 
 void mte_enable(bool sync, uint16_t tag_mask);
 void mte_disable();
 
+#if defined(MTE_EMULATION)
+// Software emulation of MTE, see lib/mte_emulation.c. Memory tags are kept in a
+// shadow array, and only accesses made through mte_access (or the load and
+// store helpers below) are checked. Nothing is mapped with PROT_MTE, since the
+// hardware may not support it.
+#undef PROT_MTE
+#define PROT_MTE 0
+
+void* mte_emulation_tag(void* ptr, size_t len, bool zero);
+void* mte_emulation_access(void* ptr, size_t size);
+void* mte_emulation_syscall_ptr(void* ptr, size_t size);
+
+__attribute__((always_inline))
+inline void* mte_tag_and_zero(void* ptr, size_t len) {
+  return mte_emulation_tag(ptr, len, true);
+}
+
+__attribute__((always_inline))
+inline void* mte_tag_granule_and_zero(void* ptr) {
+  return mte_emulation_tag(ptr, 16, true);
+}
+
+__attribute__((always_inline))
+inline void* mte_tag(void* ptr, size_t len) {
+  return mte_emulation_tag(ptr, len, false);
+}
+
+// Checks the tags for an access of size bytes at ptr, and returns a pointer
+// that can be dereferenced for that access.
+__attribute__((always_inline))
+inline void* mte_access(void* ptr, size_t size) {
+  return mte_emulation_access(ptr, size);
+}
+
+// Returns the pointer to pass to a system call that accesses size bytes at ptr,
+// which makes the call fail with EFAULT where the kernel would detect a tag
+// mismatch.
+__attribute__((always_inline))
+inline void* mte_syscall_ptr(void* ptr, size_t size) {
+  return mte_emulation_syscall_ptr(ptr, size);
+}
+
+#else
 __attribute__((always_inline))
 inline void* mte_tag_and_zero(void* ptr, size_t len) {
   asm volatile ("irg %0, %0\n" : "+r"(ptr));
@@ -36,6 +86,15 @@ inline void* mte_tag_and_zero(void* ptr, size_t len) {
   return ptr;
 }
 
+// Retags and zeroes only the granule at ptr, for tests that need a fresh tag
+// but only touch a single granule.
+__attribute__((always_inline))
+inline void* mte_tag_granule_and_zero(void* ptr) {
+  asm volatile ("irg %0, %0\n" : "+r"(ptr));
+  asm volatile ("stzg %0, [%0]\n" : : "r"(ptr) : "memory");
+  return ptr;
+}
+
 __attribute__((always_inline))
 inline void* mte_tag(void* ptr, size_t len) {
   asm volatile ("irg %0, %0\n" : "+r"(ptr));
@@ -46,9 +105,43 @@ inline void* mte_tag(void* ptr, size_t len) {
   return ptr;
 }
 
+// With hardware MTE, the access or system call itself is checked.
+__attribute__((always_inline))
+inline void* mte_access(void* ptr, size_t size) {
+  (void)size;
+  return ptr;
+}
+
+__attribute__((always_inline))
+inline void* mte_syscall_ptr(void* ptr, size_t size) {
+  (void)size;
+  return ptr;
+}
+#endif
+
 __attribute__((always_inline))
 inline void* mte_strip_tag(void* ptr) {
   return (uint64_t*)((uintptr_t)ptr & 0xfffffffffffffful);
 }
 
+__attribute__((always_inline))
+inline uint8_t mte_load8(void* ptr) {
+  return *(volatile uint8_t*)mte_access(ptr, sizeof(uint8_t));
+}
+
+__attribute__((always_inline))
+inline uint64_t mte_load64(void* ptr) {
+  return *(volatile uint64_t*)mte_access(ptr, sizeof(uint64_t));
+}
+
+__attribute__((always_inline))
+inline void mte_store8(void* ptr, uint8_t value) {
+  *(volatile uint8_t*)mte_access(ptr, sizeof(uint8_t)) = value;
+}
+
+__attribute__((always_inline))
+inline void mte_store64(void* ptr, uint64_t value) {
+  *(volatile uint64_t*)mte_access(ptr, sizeof(uint64_t)) = value;
+}
+
 #endif // MTE_H_
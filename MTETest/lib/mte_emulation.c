@@ -0,0 +1,283 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "mte.h"
+
+#if defined(MTE_EMULATION)
+
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#define MTE_GRANULE_SHIFT (4)
+#define MTE_TAG_SHIFT (56)
+#define MTE_TAG_MASK ((uintptr_t)0xf)
+
+// The shadow covers a 48-bit address space, with one tag byte for each
+// granule. Reserving all 16TiB of it up front fails without overcommit (and
+// under mlockall), so it's split into regions that are only mapped once
+// memory in them is tagged. Untagged memory has tag 0.
+#define MTE_EMULATION_ADDRESS_BITS (48)
+#define MTE_EMULATION_REGION_BITS (28)
+#define MTE_EMULATION_REGION_COUNT \
+    ((size_t)1 << (MTE_EMULATION_ADDRESS_BITS - MTE_EMULATION_REGION_BITS))
+#define MTE_EMULATION_REGION_SHADOW_SIZE \
+    ((size_t)1 << (MTE_EMULATION_REGION_BITS - MTE_GRANULE_SHIFT))
+
+#ifndef SEGV_MTEAERR
+#define SEGV_MTEAERR (8)
+#endif
+#ifndef SEGV_MTESERR
+#define SEGV_MTESERR (9)
+#endif
+#ifndef sigev_notify_thread_id
+#define sigev_notify_thread_id _sigev_un._tid
+#endif
+
+typedef enum {
+  MTE_EMULATION_NONE,
+  MTE_EMULATION_SYNC,
+  MTE_EMULATION_ASYNC,
+} mte_emulation_mode_t;
+
+// Unlike the prctl, the mode applies to the whole process rather than only the
+// calling thread, which is all the tests need.
+static mte_emulation_mode_t emulation_mode = MTE_EMULATION_NONE;
+static uint16_t emulation_tag_mask = DEFAULT_TAG_MASK;
+
+static uint8_t* shadow_regions[MTE_EMULATION_REGION_COUNT];
+
+static __thread uint64_t random_state = 0;
+
+// An async tag check fault waiting to be reported to this thread, and the timer
+// that reports it if the thread doesn't make a system call first.
+static __thread bool async_pending = false;
+static __thread bool async_timer_created = false;
+static __thread timer_t async_timer;
+
+static pid_t current_tid() {
+  return syscall(SYS_gettid);
+}
+
+// Returns the shadow of the region containing address, mapping it if
+// necessary. Threads may race to map the same region, and all but one of them
+// unmap theirs again.
+static uint8_t* shadow_region(uintptr_t address) {
+  assert(address >> MTE_EMULATION_ADDRESS_BITS == 0);
+  uint8_t** slot = &shadow_regions[address >> MTE_EMULATION_REGION_BITS];
+  uint8_t* region = __atomic_load_n(slot, __ATOMIC_ACQUIRE);
+  if (region) {
+    return region;
+  }
+
+  region = mmap(NULL, MTE_EMULATION_REGION_SHADOW_SIZE, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+  if (region == MAP_FAILED) {
+    fprintf(stderr, "mte emulation: can't map %zu bytes of tag shadow for %#lx: %s\n",
+            MTE_EMULATION_REGION_SHADOW_SIZE, (unsigned long)address, strerror(errno));
+    abort();
+  }
+  uint8_t* expected = NULL;
+  if (!__atomic_compare_exchange_n(slot, &expected, region, false,
+                                   __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+    munmap(region, MTE_EMULATION_REGION_SHADOW_SIZE);
+    region = expected;
+  }
+  return region;
+}
+
+static inline uint8_t shadow_tag(uintptr_t address) {
+  assert(address >> MTE_EMULATION_ADDRESS_BITS == 0);
+  const uint8_t* region = __atomic_load_n(
+      &shadow_regions[address >> MTE_EMULATION_REGION_BITS], __ATOMIC_ACQUIRE);
+  if (!region) {
+    return 0;
+  }
+  return region[(address & ((1ul << MTE_EMULATION_REGION_BITS) - 1)) >> MTE_GRANULE_SHIFT];
+}
+
+static void shadow_set_tag(uintptr_t address, size_t granules, uint8_t tag) {
+  while (granules) {
+    uint8_t* region = shadow_region(address);
+    size_t index = (address & ((1ul << MTE_EMULATION_REGION_BITS) - 1)) >> MTE_GRANULE_SHIFT;
+    size_t count = MTE_EMULATION_REGION_SHADOW_SIZE - index;
+    if (count > granules) {
+      count = granules;
+    }
+    memset(&region[index], tag, count);
+    granules -= count;
+    address += count << MTE_GRANULE_SHIFT;
+  }
+}
+
+static inline uint8_t pointer_tag(void* ptr) {
+  return ((uintptr_t)ptr >> MTE_TAG_SHIFT) & MTE_TAG_MASK;
+}
+
+// Equivalent to irg, choosing a random tag from those allowed by the tag mask
+// passed to mte_enable (or tag 0 if none are allowed).
+static uint8_t random_tag() {
+  if (!random_state) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    random_state = ((uint64_t)ts.tv_nsec << 32) ^ ts.tv_sec ^ current_tid();
+    random_state |= 1;
+  }
+  random_state ^= random_state << 13;
+  random_state ^= random_state >> 7;
+  random_state ^= random_state << 17;
+
+  int allowed = __builtin_popcount(emulation_tag_mask);
+  if (!allowed) {
+    return 0;
+  }
+  int choice = random_state % allowed;
+  for (uint8_t tag = 0;; ++tag) {
+    if ((emulation_tag_mask & (1 << tag)) && !choice--) {
+      return tag;
+    }
+  }
+}
+
+static void deliver_fault(int code, void* fault_address) {
+  siginfo_t info;
+  memset(&info, 0, sizeof(info));
+  info.si_signo = SIGSEGV;
+  info.si_code = code;
+  info.si_addr = fault_address;
+  syscall(SYS_rt_tgsigqueueinfo, getpid(), current_tid(), SIGSEGV, &info);
+}
+
+// The timer sends SIGSEGV directly, so faults reported this way have si_code
+// SI_TIMER rather than SEGV_MTEAERR.
+static void arm_async_timer() {
+  if (!async_timer_created) {
+    struct sigevent sev;
+    memset(&sev, 0, sizeof(sev));
+    sev.sigev_notify = SIGEV_THREAD_ID;
+    sev.sigev_signo = SIGSEGV;
+    sev.sigev_notify_thread_id = current_tid();
+    assert(0 == timer_create(CLOCK_MONOTONIC, &sev, &async_timer));
+    async_timer_created = true;
+  }
+
+  struct itimerspec its;
+  memset(&its, 0, sizeof(its));
+  its.it_value.tv_sec = MTE_EMULATION_ASYNC_DELAY_US / 1000000;
+  its.it_value.tv_nsec = (MTE_EMULATION_ASYNC_DELAY_US % 1000000) * 1000;
+  assert(0 == timer_settime(async_timer, 0, &its, NULL));
+}
+
+static void disarm_async_timer() {
+  struct itimerspec its;
+  memset(&its, 0, sizeof(its));
+  assert(0 == timer_settime(async_timer, 0, &its, NULL));
+}
+
+// Clears async_pending once the timer has reported the fault.
+static void update_async_pending() {
+  struct itimerspec its;
+  assert(0 == timer_gettime(async_timer, &its));
+  if (!its.it_value.tv_sec && !its.it_value.tv_nsec) {
+    async_pending = false;
+  }
+}
+
+static void tag_check_fault(void* fault_address) {
+  if (emulation_mode == MTE_EMULATION_SYNC) {
+    // On hardware a handler that returns would retry the faulting access, but
+    // here the access goes ahead.
+    deliver_fault(SEGV_MTESERR, fault_address);
+  } else if (!async_pending) {
+    async_pending = true;
+    arm_async_timer();
+  }
+}
+
+// Returns the address of the first granule in [ptr, ptr + size) whose tag
+// doesn't match the pointer tag, or NULL if all of them match.
+static void* find_mismatch(void* ptr, size_t size) {
+  uintptr_t address = (uintptr_t)mte_strip_tag(ptr);
+  uint8_t tag = pointer_tag(ptr);
+  uintptr_t end = (address + size - 1) >> MTE_GRANULE_SHIFT;
+  for (uintptr_t granule = address >> MTE_GRANULE_SHIFT; granule <= end; ++granule) {
+    if (shadow_tag(granule << MTE_GRANULE_SHIFT) != tag) {
+      uintptr_t granule_address = granule << MTE_GRANULE_SHIFT;
+      if (granule_address < address) {
+        granule_address = address;
+      }
+      return (void*)granule_address;
+    }
+  }
+  return NULL;
+}
+
+void mte_enable(bool sync, uint16_t tag_mask) {
+  emulation_mode = sync ? MTE_EMULATION_SYNC : MTE_EMULATION_ASYNC;
+  emulation_tag_mask = tag_mask;
+}
+
+void mte_disable() {
+  emulation_mode = MTE_EMULATION_NONE;
+}
+
+void* mte_emulation_tag(void* ptr, size_t len, bool zero) {
+  uintptr_t address = (uintptr_t)mte_strip_tag(ptr);
+  assert(address % (1 << MTE_GRANULE_SHIFT) == 0);
+
+  // Like stg and stzg, this tags (and zeroes) whole granules.
+  size_t granules = (len + (1 << MTE_GRANULE_SHIFT) - 1) >> MTE_GRANULE_SHIFT;
+  uint8_t tag = random_tag();
+  shadow_set_tag(address, granules, tag);
+  if (zero) {
+    memset((void*)address, 0, granules << MTE_GRANULE_SHIFT);
+  }
+  return (void*)(address | (uintptr_t)tag << MTE_TAG_SHIFT);
+}
+
+void* mte_emulation_access(void* ptr, size_t size) {
+  if (emulation_mode != MTE_EMULATION_NONE && size) {
+    if (async_pending) {
+      update_async_pending();
+    }
+    void* fault_address = find_mismatch(ptr, size);
+    if (fault_address) {
+      tag_check_fault(fault_address);
+    }
+  }
+  return mte_strip_tag(ptr);
+}
+
+void* mte_emulation_syscall_ptr(void* ptr, size_t size) {
+  // Pending async faults are reported on entry to the kernel.
+  if (async_pending) {
+    disarm_async_timer();
+    async_pending = false;
+    deliver_fault(SEGV_MTEAERR, NULL);
+  }
+
+  // The kernel only checks tags for user pointers in sync mode. A tagged pointer
+  // fails with EFAULT, since the tagged address ABI isn't enabled (and on x86_64
+  // it isn't canonical).
+  if (emulation_mode == MTE_EMULATION_SYNC && size && find_mismatch(ptr, size)) {
+    return ptr;
+  }
+  return mte_strip_tag(ptr);
+}
+
+#endif
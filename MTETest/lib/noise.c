@@ -0,0 +1,194 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "noise.h"
+
+#include <fcntl.h>
+#include <linux/perf_event.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "scheduler.h"
+
+#define INTERRUPTS_BUFFER_SIZE ((size_t)0x10000)
+
+static int fds[3] = {-1, -1, -1};
+static int interrupts_fd = -1;
+// Column of the current cpu in /proc/interrupts, which only lists online cpus.
+static int interrupts_column = -1;
+static char interrupts_buffer[INTERRUPTS_BUFFER_SIZE];
+static uint64_t start_interrupts;
+static noise_t value;
+
+static int open_software_counter(uint64_t config) {
+  struct perf_event_attr event_attr = {0};
+  event_attr.type = PERF_TYPE_SOFTWARE;
+  event_attr.size = sizeof(event_attr);
+  event_attr.config = config;
+  // Count for this thread on whichever cpu it runs, so that migrations are
+  // counted too.
+  return syscall(SYS_perf_event_open, &event_attr, 0, -1, -1, 0);
+}
+
+static uint64_t read_counter(int fd) {
+  uint64_t count = 0;
+  if (fd >= 0 && sizeof(count) != read(fd, &count, sizeof(count))) {
+    count = 0;
+  }
+  return count;
+}
+
+static const char* read_interrupts() {
+  if (interrupts_fd < 0 || -1 == lseek(interrupts_fd, 0, SEEK_SET)) {
+    return NULL;
+  }
+  size_t size = 0;
+  ssize_t result;
+  while (size < INTERRUPTS_BUFFER_SIZE - 1
+         && 0 < (result = read(interrupts_fd, interrupts_buffer + size,
+                               INTERRUPTS_BUFFER_SIZE - 1 - size))) {
+    size += result;
+  }
+  interrupts_buffer[size] = '\0';
+  return interrupts_buffer;
+}
+
+static uint64_t count_interrupts() {
+  const char* line = read_interrupts();
+  if (!line || interrupts_column < 0) {
+    return 0;
+  }
+
+  // Each line after the header is "name: count count ... description", with
+  // one count per online cpu, except for a few lines with a single total.
+  uint64_t count = 0;
+  line = strchr(line, '\n');
+  while (line && *++line) {
+    const char* ptr = strchr(line, ':');
+    const char* end = strchr(line, '\n');
+    if (ptr && (!end || ptr < end)) {
+      ptr += 1;
+      for (int column = 0; column <= interrupts_column; ++column) {
+        char* next;
+        uint64_t column_count = strtoull(ptr, &next, 10);
+        if (next == ptr || (end && next > end)) {
+          break;
+        }
+        if (column == interrupts_column) {
+          count += column_count;
+        }
+        ptr = next;
+      }
+    }
+    line = end;
+  }
+  return count;
+}
+
+void noise_start() {
+  fds[0] = open_software_counter(PERF_COUNT_SW_CONTEXT_SWITCHES);
+  fds[1] = open_software_counter(PERF_COUNT_SW_CPU_MIGRATIONS);
+  fds[2] = open_software_counter(PERF_COUNT_SW_PAGE_FAULTS);
+  if (fds[0] < 0 || fds[1] < 0 || fds[2] < 0) {
+    fprintf(stderr, "noise: software performance counters unavailable\n");
+  }
+
+  interrupts_fd = open("/proc/interrupts", O_RDONLY);
+  const char* header = read_interrupts();
+  if (header) {
+    char name[16];
+    snprintf(name, sizeof(name), "CPU%i", cpu_currently_on());
+    int column = 0;
+    const char* end = strchr(header, '\n');
+    for (const char* ptr = header; ptr && (!end || ptr < end); ++column) {
+      ptr += strspn(ptr, " \t");
+      size_t length = strcspn(ptr, " \t\n");
+      if (!length) {
+        break;
+      }
+      if (length == strlen(name) && !strncmp(ptr, name, length)) {
+        interrupts_column = column;
+        break;
+      }
+      ptr += length;
+    }
+  }
+  if (interrupts_column < 0) {
+    fprintf(stderr, "noise: interrupt counts unavailable\n");
+  }
+  start_interrupts = count_interrupts();
+
+  noise_read();
+}
+
+noise_t noise_read() {
+  noise_t prev_value = value;
+  value.context_switches = read_counter(fds[0]);
+  value.migrations = read_counter(fds[1]);
+  value.page_faults = read_counter(fds[2]);
+
+  noise_t return_value = value;
+  return_value.context_switches -= prev_value.context_switches;
+  return_value.migrations -= prev_value.migrations;
+  return_value.page_faults -= prev_value.page_faults;
+  return return_value;
+}
+
+void noise_stop(noise_stats_t* stats) {
+  stats->interrupts += count_interrupts() - start_interrupts;
+
+  for (size_t i = 0; i < sizeof(fds) / sizeof(fds[0]); ++i) {
+    if (fds[i] >= 0) {
+      close(fds[i]);
+      fds[i] = -1;
+    }
+  }
+  if (interrupts_fd >= 0) {
+    close(interrupts_fd);
+    interrupts_fd = -1;
+  }
+  interrupts_column = -1;
+  memset(&value, 0, sizeof(value));
+}
+
+bool noise_disturbed(const noise_t* noise) {
+  return noise->context_switches || noise->migrations || noise->page_faults;
+}
+
+void noise_stats_reset(noise_stats_t* stats) {
+  memset(stats, 0, sizeof(*stats));
+}
+
+void noise_stats_add(noise_stats_t* stats, const noise_t* noise, bool discarded) {
+  stats->batches += 1;
+  stats->disturbed_batches += noise_disturbed(noise);
+  stats->discarded_batches += discarded;
+  stats->total.context_switches += noise->context_switches;
+  stats->total.migrations += noise->migrations;
+  stats->total.page_faults += noise->page_faults;
+}
+
+void print_noise_stats(const noise_stats_t* stats) {
+  fprintf(stderr, "noise: %lu/%lu batches disturbed [%1.1f%%], %lu discarded [%1.1f%%], "
+                  "%lu context switches, %lu migrations, %lu page faults, "
+                  "%lu interrupts during the run\n",
+          stats->disturbed_batches, stats->batches,
+          stats->batches ? 100.0 * stats->disturbed_batches / stats->batches : 0.0,
+          stats->discarded_batches,
+          stats->batches ? 100.0 * stats->discarded_batches / stats->batches : 0.0,
+          stats->total.context_switches, stats->total.migrations,
+          stats->total.page_faults, stats->interrupts);
+}
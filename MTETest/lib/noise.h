@@ -0,0 +1,62 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NOISE_H_
+#define NOISE_H_
+
+#include "config.h"
+
+// Detection of disturbances during measurements: context switches, migrations
+// and page faults from software performance counters. Tests read the counters
+// around each batch of samples, and tag or discard the samples from disturbed
+// batches. Interrupts on the current cpu only come from parsing
+// /proc/interrupts, which takes longer than a batch and would itself disturb
+// most of them, so they are counted once for the whole run instead.
+
+typedef enum {
+  NOISE_IGNORE,
+  NOISE_TAG,
+  NOISE_DISCARD,
+} noise_mode_t;
+
+typedef struct {
+  uint64_t context_switches;
+  uint64_t migrations;
+  uint64_t page_faults;
+} noise_t;
+
+typedef struct {
+  uint64_t batches;
+  uint64_t disturbed_batches;
+  uint64_t discarded_batches;
+  noise_t total;
+  uint64_t interrupts;
+} noise_stats_t;
+
+// Opens the counters for the calling thread and the cpu that it's pinned to.
+void noise_start();
+
+// Closes the counters, adding the interrupts since noise_start to stats.
+void noise_stop(noise_stats_t* stats);
+
+// Returns the counter deltas since the previous call.
+noise_t noise_read();
+
+bool noise_disturbed(const noise_t* noise);
+
+void noise_stats_reset(noise_stats_t* stats);
+void noise_stats_add(noise_stats_t* stats, const noise_t* noise, bool discarded);
+void print_noise_stats(const noise_stats_t* stats);
+
+#endif // NOISE_H_
@@ -0,0 +1,220 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "persistent.h"
+
+#include <assert.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "mte.h"
+#include "workers.h"
+
+// Exit status of a child whose iteration failed, distinct from the exit(1) of
+// the harnesses' fatal signal handlers.
+#define PERSISTENT_EXIT_FAILED (3)
+
+// Shared with the child for each iteration.
+typedef struct {
+  uint64_t trigger_ns;
+} persistent_state_t;
+
+static persistent_state_t* persistent_state = NULL;
+
+static uint64_t monotonic_ns() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static const char* outcome_name(persistent_outcome_t outcome) {
+  switch (outcome) {
+    case PERSISTENT_BYPASSED:
+      return "bypassed";
+    case PERSISTENT_CAUGHT:
+      return "caught";
+    case PERSISTENT_TIMEOUT:
+      return "timeout";
+    case PERSISTENT_FAILED:
+      return "failed";
+    case PERSISTENT_NO_TRIGGER:
+      return "no_trigger";
+    case PERSISTENT_OUTCOME_COUNT:
+      break;
+  }
+  return "unknown";
+}
+
+static int compare_u64(const void* lhs, const void* rhs) {
+  uint64_t l = *(const uint64_t*)lhs;
+  uint64_t r = *(const uint64_t*)rhs;
+  return (l > r) - (l < r);
+}
+
+char* read_file(const char* path) {
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    return NULL;
+  }
+
+  struct stat st;
+  char* data = NULL;
+  if (!fstat(fd, &st) && (data = malloc(st.st_size + 1))) {
+    size_t data_read = 0;
+    while (data_read < (size_t)st.st_size) {
+      ssize_t result = read(fd, &data[data_read], st.st_size - data_read);
+      if (result <= 0) {
+        break;
+      }
+      data_read += result;
+    }
+    data[data_read] = '\0';
+  }
+  close(fd);
+  return data;
+}
+
+void persistent_trigger() {
+  if (persistent_state) {
+    persistent_state->trigger_ns = monotonic_ns();
+  }
+}
+
+// Runs a single iteration, and returns its outcome and the time since the
+// trigger (or since the start, if the child didn't reach it).
+static persistent_outcome_t run_iteration(size_t variant,
+                                          persistent_function_t function,
+                                          void* arg, uint64_t* time_ns) {
+  persistent_state->trigger_ns = 0;
+  uint64_t start_ns = monotonic_ns();
+
+  pid_t pid = fork();
+  assert(pid >= 0);
+  if (pid == 0) {
+    // The exploits print progress, which would swamp the results.
+    int null_fd = open("/dev/null", O_WRONLY);
+    assert(null_fd >= 0);
+    dup2(null_fd, STDOUT_FILENO);
+    dup2(null_fd, STDERR_FILENO);
+
+    sigset_t mask;
+    sigemptyset(&mask);
+    sigprocmask(SIG_SETMASK, &mask, NULL);
+
+    bool completed = function(variant, arg);
+    // _exit is a system call too, so a pending async tag check fault is
+    // reported before it, as on hardware. This only matters under emulation.
+    mte_syscall_ptr(NULL, 0);
+    _exit(completed ? 0 : PERSISTENT_EXIT_FAILED);
+  }
+
+  // SIGCHLD is blocked, so that it can be waited for with a timeout.
+  sigset_t sigchld;
+  sigemptyset(&sigchld);
+  sigaddset(&sigchld, SIGCHLD);
+  struct timespec timeout = {
+    .tv_sec = PERSISTENT_TIMEOUT_MS / 1000,
+    .tv_nsec = (PERSISTENT_TIMEOUT_MS % 1000) * 1000000,
+  };
+
+  persistent_outcome_t outcome = PERSISTENT_TIMEOUT;
+  int status;
+  while (true) {
+    pid_t result = waitpid(pid, &status, WNOHANG);
+    assert(result >= 0);
+    if (result == pid) {
+      if (!WIFEXITED(status)) {
+        outcome = PERSISTENT_CAUGHT;
+      } else if (WEXITSTATUS(status) == PERSISTENT_EXIT_FAILED) {
+        outcome = PERSISTENT_FAILED;
+      } else if (WEXITSTATUS(status)) {
+        outcome = PERSISTENT_CAUGHT;
+      } else {
+        outcome = persistent_state->trigger_ns ? PERSISTENT_BYPASSED
+                                               : PERSISTENT_NO_TRIGGER;
+      }
+      break;
+    }
+    if (sigtimedwait(&sigchld, NULL, &timeout) < 0) {
+      kill(pid, SIGKILL);
+      assert(pid == waitpid(pid, &status, 0));
+      break;
+    }
+  }
+
+  uint64_t end_ns = monotonic_ns();
+  uint64_t trigger_ns = persistent_state->trigger_ns;
+  *time_ns = end_ns - (trigger_ns ? trigger_ns : start_ns);
+  return outcome;
+}
+
+void run_persistent(size_t iterations, size_t variant_count,
+                    char* const* names, persistent_function_t function,
+                    void* arg) {
+  persistent_state = map_shared(sizeof(*persistent_state));
+  uint64_t* bypass_times = calloc(iterations, sizeof(uint64_t));
+  size_t* counts = calloc(variant_count * PERSISTENT_OUTCOME_COUNT, sizeof(size_t));
+  assert(bypass_times && counts);
+
+  sigset_t sigchld;
+  sigemptyset(&sigchld);
+  sigaddset(&sigchld, SIGCHLD);
+  sigprocmask(SIG_BLOCK, &sigchld, NULL);
+
+  // Anything still buffered would otherwise be written again by every child.
+  fflush(NULL);
+
+  fprintf(stdout, "variant,iteration,outcome,time_us\n");
+  for (size_t variant = 0; variant < variant_count; ++variant) {
+    size_t* variant_counts = &counts[variant * PERSISTENT_OUTCOME_COUNT];
+    size_t bypasses = 0;
+    uint64_t start_ns = monotonic_ns();
+
+    for (size_t i = 0; i < iterations; ++i) {
+      uint64_t time_ns;
+      persistent_outcome_t outcome = run_iteration(variant, function, arg, &time_ns);
+      ++variant_counts[outcome];
+      if (outcome == PERSISTENT_BYPASSED) {
+        bypass_times[bypasses++] = time_ns;
+      }
+      fprintf(stdout, "%zu,%zu,%s,%lu\n", variant, i, outcome_name(outcome),
+              (unsigned long)(time_ns / 1000));
+    }
+
+    double elapsed = (monotonic_ns() - start_ns) / 1e9;
+    fprintf(stderr, "%s: %zu/%zu bypassed (%.1f%%), %zu caught, %zu timed out,"
+            " %zu failed, %zu without reaching the trigger, %.0f iterations/minute\n",
+            names[variant], bypasses, iterations, 100.0 * bypasses / iterations,
+            variant_counts[PERSISTENT_CAUGHT], variant_counts[PERSISTENT_TIMEOUT],
+            variant_counts[PERSISTENT_FAILED], variant_counts[PERSISTENT_NO_TRIGGER],
+            iterations * 60 / elapsed);
+    if (bypasses) {
+      qsort(bypass_times, bypasses, sizeof(uint64_t), compare_u64);
+      fprintf(stderr, "  time to bypass: min %luus, median %luus, max %luus\n",
+              (unsigned long)(bypass_times[0] / 1000),
+              (unsigned long)(bypass_times[bypasses / 2] / 1000),
+              (unsigned long)(bypass_times[bypasses - 1] / 1000));
+    }
+  }
+
+  sigprocmask(SIG_UNBLOCK, &sigchld, NULL);
+  free(counts);
+  free(bypass_times);
+}
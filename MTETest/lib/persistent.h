@@ -0,0 +1,52 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef PERSISTENT_H_
+#define PERSISTENT_H_
+
+#include "config.h"
+
+// Persistent mode for the bypass harnesses. The parent process keeps a warmed
+// script engine with every variant already loaded, and runs each iteration in a
+// forked child, so that the state the exploits corrupt (heap, signal handlers,
+// vtables) is reset without the cost of starting a new process.
+
+typedef enum {
+  PERSISTENT_BYPASSED,     // The child reached the trigger and completed.
+  PERSISTENT_CAUGHT,       // The child was killed or exited with an error.
+  PERSISTENT_TIMEOUT,      // The child ran for PERSISTENT_TIMEOUT_MS.
+  PERSISTENT_FAILED,       // The iteration itself failed, eg. the script threw.
+  PERSISTENT_NO_TRIGGER,   // The child completed without reaching the trigger.
+  PERSISTENT_OUTCOME_COUNT,
+} persistent_outcome_t;
+
+// Returns whether the iteration ran to completion.
+typedef bool (*persistent_function_t)(size_t variant, void* arg);
+
+// Reads the whole file at path into a single NUL-terminated allocation.
+char* read_file(const char* path);
+
+// Records the time of the tag check failure in the current iteration, which
+// the time to bypass is measured from.
+void persistent_trigger();
+
+// Runs iterations iterations of each of the variant_count variants, calling
+// function(variant, arg) in a child process for each one. Prints the outcome
+// and time to bypass of each iteration as CSV to stdout, and a summary for each
+// variant (named by names) to stderr.
+void run_persistent(size_t iterations, size_t variant_count,
+                    char* const* names, persistent_function_t function,
+                    void* arg);
+
+#endif // PERSISTENT_H_
@@ -0,0 +1,232 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "results.h"
+
+#include <assert.h>
+#include <fcntl.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static const result_field_t result_fields[RESULT_FIELD_COUNT] = {
+  {"cpu", RESULT_FIELD_UINT16, offsetof(result_t, cpu)},
+  {"tag_match", RESULT_FIELD_UINT8, offsetof(result_t, tag_match)},
+  {"flags", RESULT_FIELD_UINT8, offsetof(result_t, flags)},
+  {"nop_count", RESULT_FIELD_UINT32, offsetof(result_t, nop_count)},
+  {"latency", RESULT_FIELD_UINT64, offsetof(result_t, latency)},
+};
+
+static void write_all(int fd, const void* data, size_t size) {
+  const char* ptr = data;
+  while (size) {
+    ssize_t result = write(fd, ptr, size);
+    assert(result > 0);
+    ptr += result;
+    size -= result;
+  }
+}
+
+results_t* results_open(const char* path, uint64_t timer_frequency, uint64_t seed) {
+  // The buffer is mapped rather than malloc'd so that it's page-aligned and
+  // can be prefaulted before the test starts.
+  results_t* results = mmap(NULL, sizeof(results_t), PROT_READ|PROT_WRITE,
+    MAP_ANONYMOUS|MAP_PRIVATE|MAP_POPULATE, -1, 0);
+  assert(results != MAP_FAILED);
+
+  results->fd = open(path, O_WRONLY|O_CREAT|O_TRUNC, 0644);
+  assert(results->fd >= 0);
+  results->count = 0;
+
+  results_header_t* header = &results->header;
+  memset(header, 0, sizeof(*header));
+  memcpy(header->magic, RESULTS_MAGIC, sizeof(RESULTS_MAGIC));
+  header->version = RESULTS_VERSION;
+  header->header_size = sizeof(*header);
+  header->record_size = sizeof(result_t);
+  header->field_count = RESULT_FIELD_COUNT;
+  header->timer_frequency = timer_frequency;
+  header->seed = seed;
+  memcpy(header->fields, result_fields, sizeof(result_fields));
+  write_all(results->fd, header, sizeof(*header));
+
+  return results;
+}
+
+void results_flush(results_t* results) {
+  write_all(results->fd, results->records, results->count * sizeof(result_t));
+  results->count = 0;
+}
+
+void results_close(results_t* results) {
+  results_flush(results);
+  close(results->fd);
+  munmap(results, sizeof(results_t));
+}
+
+void results_add_calibration(results_t* results,
+                             const result_calibration_t* calibration) {
+  results_header_t* header = &results->header;
+  size_t i = 0;
+  while (i < header->calibration_count && header->calibrations[i].cpu != calibration->cpu) {
+    ++i;
+  }
+  if (i == RESULTS_MAX_CALIBRATIONS) {
+    fprintf(stderr, "too many calibrations, dropping cpu %u\n", calibration->cpu);
+    return;
+  }
+  header->calibrations[i] = *calibration;
+  if (i == header->calibration_count) {
+    header->calibration_count += 1;
+  }
+  // The header is rewritten in place, so calibrations can be added at any time.
+  assert(sizeof(*header) == pwrite(results->fd, header, sizeof(*header), 0));
+}
+
+// Appends the records from the results file at path, which must have been
+// written by this build (e.g. by a sweep worker). A worker that died mid-flush
+// can leave a partial record at the end, which is dropped.
+bool results_merge(results_t* results, const char* path) {
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  results_header_t header;
+  struct stat st;
+  if (!results_read_header(fd, &header) || fstat(fd, &st)) {
+    close(fd);
+    return false;
+  }
+  if (header.record_size != sizeof(result_t)
+      || header.field_count != RESULT_FIELD_COUNT
+      || memcmp(header.fields, result_fields, sizeof(result_fields))) {
+    fprintf(stderr, "%s: records don't match this build's result_t\n", path);
+    close(fd);
+    return false;
+  }
+  for (size_t i = 0; i < header.calibration_count; ++i) {
+    results_add_calibration(results, &header.calibrations[i]);
+  }
+
+  size_t records_size = st.st_size > header.header_size ? st.st_size - header.header_size : 0;
+  if (records_size % sizeof(result_t)) {
+    fprintf(stderr, "%s: dropping %zu bytes of a partial record\n", path,
+            records_size % sizeof(result_t));
+  }
+
+  // The records are already in our format, so copy them across in bulk using
+  // the record buffer. Only whole records are read.
+  results_flush(results);
+  size_t count;
+  while ((count = results_read_records(fd, results->records, sizeof(result_t),
+                                       RESULTS_BUFFER_RECORDS)) > 0) {
+    write_all(results->fd, results->records, count * sizeof(result_t));
+  }
+  close(fd);
+  return true;
+}
+
+// Fields that every speculation_window results file has. flags was added
+// later, so it's optional.
+static const char* const required_fields[] = {"cpu", "tag_match", "nop_count", "latency"};
+
+// Checks that the field table describes values that fit in a record and in a
+// uint64_t, so that results_field_value can't read outside either of them.
+static bool results_check_fields(const results_header_t* header) {
+  if (!header->record_size || header->record_size > RESULTS_MAX_RECORD_SIZE) {
+    return false;
+  }
+  for (size_t i = 0; i < header->field_count; ++i) {
+    const result_field_t* field = &header->fields[i];
+    if ((field->type != RESULT_FIELD_UINT8 && field->type != RESULT_FIELD_UINT16
+         && field->type != RESULT_FIELD_UINT32 && field->type != RESULT_FIELD_UINT64)
+        || (uint32_t)field->offset + field->type > header->record_size) {
+      return false;
+    }
+    for (size_t j = 0; j < i; ++j) {
+      if (!strncmp(header->fields[j].name, field->name, sizeof(field->name))) {
+        return false;
+      }
+    }
+  }
+  for (size_t i = 0; i < sizeof(required_fields) / sizeof(required_fields[0]); ++i) {
+    if (results_find_field(header, required_fields[i]) < 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool results_read_header(int fd, results_header_t* header) {
+  // Version 1 headers end before the calibrations.
+  const size_t v1_size = offsetof(results_header_t, calibration_count);
+  memset(header, 0, sizeof(*header));
+  if ((ssize_t)v1_size != read(fd, header, v1_size)) {
+    return false;
+  }
+  if (memcmp(header->magic, RESULTS_MAGIC, sizeof(RESULTS_MAGIC))
+      || header->version < 1
+      || header->field_count > RESULT_FIELD_COUNT
+      || !results_check_fields(header)) {
+    return false;
+  }
+  if (header->version >= 2) {
+    const size_t rest_size = sizeof(*header) - v1_size;
+    if (header->header_size < sizeof(*header)
+        || (ssize_t)rest_size != read(fd, (uint8_t*)header + v1_size, rest_size)
+        || header->calibration_count > RESULTS_MAX_CALIBRATIONS) {
+      return false;
+    }
+  }
+  // Records are described by the field table, so we only need to skip over
+  // anything a newer writer appended to the header.
+  return header->header_size >= v1_size
+      && -1 != lseek(fd, header->header_size, SEEK_SET);
+}
+
+size_t results_read_records(int fd, void* buffer, size_t record_size,
+                            size_t max_records) {
+  size_t size = 0;
+  size_t max_size = record_size * max_records;
+  while (size < max_size) {
+    ssize_t result = read(fd, (uint8_t*)buffer + size, max_size - size);
+    if (result <= 0) {
+      break;
+    }
+    size += result;
+  }
+  return size / record_size;
+}
+
+int results_find_field(const results_header_t* header, const char* name) {
+  for (size_t i = 0; i < header->field_count; ++i) {
+    if (!strncmp(header->fields[i].name, name, sizeof(header->fields[i].name))) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+const result_calibration_t* results_find_calibration(const results_header_t* header,
+                                                     int cpu) {
+  for (size_t i = 0; i < header->calibration_count; ++i) {
+    if (header->calibrations[i].cpu == cpu) {
+      return &header->calibrations[i];
+    }
+  }
+  return NULL;
+}
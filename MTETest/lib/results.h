@@ -0,0 +1,146 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RESULTS_H_
+#define RESULTS_H_
+
+#include "config.h"
+
+#include <string.h>
+
+// Fixed-size binary result records. These are buffered in memory and written
+// out in large blocks, so that collecting results doesn't add formatting or
+// pipe I/O between samples. The file starts with a header describing the
+// record layout, which results_convert uses to produce CSV or columnar output
+// on the host.
+
+#define RESULTS_MAGIC "MTERSLT"
+#define RESULTS_VERSION (2)
+#define RESULTS_BUFFER_RECORDS ((size_t)0x10000)
+#define RESULTS_MAX_CALIBRATIONS ((size_t)64)
+// Field offsets are a byte, so no reader needs to handle larger records.
+#define RESULTS_MAX_RECORD_SIZE ((uint32_t)256)
+
+// The sample was taken during a batch that was disturbed by a context switch,
+// migration, page fault or interrupt (see lib/noise.h).
+#define RESULT_FLAG_DISTURBED ((uint8_t)1 << 0)
+// The sample was taken after the hardening watchdog dropped SCHED_FIFO
+// priority (see lib/environment.h).
+#define RESULT_FLAG_DEMOTED ((uint8_t)1 << 1)
+
+typedef struct {
+  uint16_t cpu;
+  uint8_t tag_match;
+  uint8_t flags;
+  uint32_t nop_count;
+  uint64_t latency;
+} result_t;
+
+typedef enum {
+  RESULT_FIELD_UINT8 = 1,
+  RESULT_FIELD_UINT16 = 2,
+  RESULT_FIELD_UINT32 = 4,
+  RESULT_FIELD_UINT64 = 8,
+} result_field_type_t;
+
+typedef struct {
+  char name[14];
+  uint8_t type;
+  uint8_t offset;
+} result_field_t;
+
+#define RESULT_FIELD_COUNT ((size_t)5)
+
+// Calibration of the test latencies on one core (see speculation_window -C),
+// from variants of the gadget whose timing load is known to hit or miss.
+typedef struct {
+  uint16_t cpu;
+  uint16_t reserved[3];
+  // Latencies below the threshold are cache hits.
+  uint64_t threshold;
+  // Median latencies with the timing load cached and uncached, for reference.
+  // Both include the fixed costs of a test and of reading the timer.
+  uint64_t hit_latency;
+  uint64_t miss_latency;
+} result_calibration_t;
+
+typedef struct {
+  char magic[8];
+  uint32_t version;
+  uint32_t header_size;
+  uint32_t record_size;
+  uint32_t field_count;
+  uint64_t timer_frequency;
+  uint64_t seed;
+  result_field_t fields[RESULT_FIELD_COUNT];
+  // Version 2 onwards.
+  uint32_t calibration_count;
+  uint32_t reserved;
+  result_calibration_t calibrations[RESULTS_MAX_CALIBRATIONS];
+} results_header_t;
+
+typedef struct {
+  int fd;
+  size_t count;
+  results_header_t header;
+  result_t records[RESULTS_BUFFER_RECORDS];
+} results_t;
+
+results_t* results_open(const char* path, uint64_t timer_frequency, uint64_t seed);
+void results_flush(results_t* results);
+void results_close(results_t* results);
+
+// Records the calibration for a core in the header, replacing any earlier
+// calibration for the same core.
+void results_add_calibration(results_t* results,
+                             const result_calibration_t* calibration);
+
+// Appends all of the records (and calibrations) from another results file.
+bool results_merge(results_t* results, const char* path);
+
+// Reads and validates the header of a results file, leaving fd positioned at
+// the first record. Returns false if the file isn't a results file, or if its
+// field table is malformed: unknown field types, fields past the end of the
+// record, duplicate fields, or missing cpu, tag_match, nop_count or latency.
+bool results_read_header(int fd, results_header_t* header);
+
+// Reads up to max_records records of record_size bytes into buffer. Returns the
+// number of whole records read, which is zero at the end of the file.
+size_t results_read_records(int fd, void* buffer, size_t record_size,
+                            size_t max_records);
+
+// Returns the index of the named field in header, or -1 if there isn't one.
+int results_find_field(const results_header_t* header, const char* name);
+
+// Returns the calibration for cpu in header, or NULL if there isn't one.
+const result_calibration_t* results_find_calibration(const results_header_t* header,
+                                                     int cpu);
+
+static inline uint64_t results_field_value(const void* record,
+                                           const result_field_t* field) {
+  uint64_t value = 0;
+  // Results are always written on little-endian machines.
+  memcpy(&value, (const uint8_t*)record + field->offset, field->type);
+  return value;
+}
+
+__attribute__((always_inline))
+static inline void results_append(results_t* results, const result_t* record) {
+  results->records[results->count++] = *record;
+  if (results->count == RESULTS_BUFFER_RECORDS) {
+    results_flush(results);
+  }
+}
+
+#endif // RESULTS_H_
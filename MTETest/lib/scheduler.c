@@ -15,6 +15,8 @@
 #include "config.h"
 
 #include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #define _GNU_SOURCE
@@ -39,4 +41,120 @@ int cpu_currently_on() {
 
 void set_max_priority() {
   setpriority(PRIO_PROCESS, 0, -20);
-}
\ No newline at end of file
+}
+static long long read_topology_value(int core, const char* name) {
+  char path[128];
+  snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%i/%s", core, name);
+  FILE* file = fopen(path, "r");
+  if (!file) {
+    return -1;
+  }
+  long long value = -1;
+  if (1 != fscanf(file, "%lli", &value)) {
+    value = -1;
+  }
+  fclose(file);
+  return value;
+}
+
+int cpu_count() {
+  return sysconf(_SC_NPROCESSORS_CONF);
+}
+
+bool cpu_online(int core) {
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  if (0 == sched_getaffinity(0, sizeof(cpu_set_t), &cpu_set)
+      && !CPU_ISSET(core, &cpu_set)) {
+    // We're not allowed to run there anyway.
+    return false;
+  }
+  // cpu0 often has no online file, since it can't be taken offline.
+  return 0 != read_topology_value(core, "online");
+}
+
+int cpu_cluster_of(int core) {
+  int cluster = read_topology_value(core, "topology/cluster_id");
+  if (cluster < 0) {
+    // Older arm64 kernels report each cluster as a separate package.
+    cluster = read_topology_value(core, "topology/physical_package_id");
+  }
+  return cluster;
+}
+
+bool cpu_is_sibling(int core, int other_core) {
+  // SMT siblings share a physical core, so report the same core_id within the
+  // same package.
+  int core_id = read_topology_value(core, "topology/core_id");
+  int package_id = read_topology_value(core, "topology/physical_package_id");
+  return core != other_core && core_id >= 0
+      && core_id == read_topology_value(other_core, "topology/core_id")
+      && package_id == read_topology_value(other_core, "topology/physical_package_id");
+}
+
+int cpu_pick_spare(int near_core, const cpu_set_t* exclude) {
+  // Prefer a core in the same cluster as near_core, since a shared cache keeps
+  // the cost of reading data written by the helper low and stable. An SMT
+  // sibling of near_core shares its pipeline, so is only used as a last resort.
+  int near_cluster = near_core >= 0 ? cpu_cluster_of(near_core) : -1;
+  int best_core = -1;
+  int best_score = -1;
+  for (int core = cpu_count() - 1; core >= 0; --core) {
+    if (core == near_core || (exclude && CPU_ISSET(core, exclude))
+        || !cpu_online(core)) {
+      continue;
+    }
+    int score = 1;
+    if (near_core >= 0 && cpu_is_sibling(core, near_core)) {
+      score = 0;
+    } else if (near_cluster >= 0 && cpu_cluster_of(core) == near_cluster) {
+      score = 2;
+    }
+    if (score > best_score) {
+      best_core = core;
+      best_score = score;
+    }
+  }
+  return best_core;
+}
+
+uint64_t cpu_type_of(int core) {
+  // On arm64 the MIDR identifies the core implementation, which is what we
+  // want to group by on big.LITTLE systems. Elsewhere fall back to the relative
+  // capacity that the scheduler uses, and otherwise assume all cores are equal.
+  long long type = read_topology_value(core, "regs/identification/midr_el1");
+  if (type < 0) {
+    type = read_topology_value(core, "cpu_capacity");
+  }
+  return type < 0 ? 0 : (uint64_t)type;
+}
+
+size_t cpu_parse_list(const char* list, int* cores, size_t max_cores) {
+  size_t count = 0;
+  const char* ptr = list;
+  while (*ptr) {
+    char* end;
+    long first = strtol(ptr, &end, 10);
+    long last = first;
+    if (end == ptr) {
+      return 0;
+    }
+    if (*end == '-') {
+      ptr = end + 1;
+      last = strtol(ptr, &end, 10);
+      if (end == ptr) {
+        return 0;
+      }
+    }
+    for (long core = first; core <= last && count < max_cores; ++core) {
+      cores[count++] = core;
+    }
+    if (*end == ',') {
+      ++end;
+    } else if (*end) {
+      return 0;
+    }
+    ptr = end;
+  }
+  return count;
+}
@@ -17,9 +17,31 @@
 
 #include "../config.h"
 
+#include <sched.h>
+
 void cpu_pin_to(int core);
 int cpu_currently_on();
 
+// CPU topology queries, based on the information exposed in sysfs. These return
+// -1 if the kernel doesn't provide the information.
+int cpu_count();
+bool cpu_online(int core);
+int cpu_cluster_of(int core);
+bool cpu_is_sibling(int core, int other_core);
+
+// Identifies the kind of core, so that results from big.LITTLE systems can be
+// kept separate per core type. Cores of the same type return the same value.
+uint64_t cpu_type_of(int core);
+
+// Parses a list of cores like "0,4-7". Returns the number of cores written to
+// cores, or 0 if the list is malformed.
+size_t cpu_parse_list(const char* list, int* cores, size_t max_cores);
+
+// Choose a core to run a helper thread on, that will interfere as little as
+// possible with measurements taken on near_core. Cores in `exclude` are never
+// chosen. Returns -1 if no suitable core is available.
+int cpu_pick_spare(int near_core, const cpu_set_t* exclude);
+
 void set_max_priority();
 
 #endif // SCHEDULER_H_
@@ -15,27 +15,151 @@
 #include "scheduler.h"
 #include "timer.h"
 
+#include <stdio.h>
+
 #if TIMER == VIRTUAL_TIMER
-void start_timer() {
+int start_timer(int measuring_cpu) {
+  (void)measuring_cpu;
+  return 0;
+}
+
+void select_timer(int index) {
+  (void)index;
+}
+
+void timer_reserve_cpu(int core) {
+  (void)core;
+}
+
+uint64_t timer_frequency() {
+  return virtual_frequency();
+}
+
+void print_timer_info() {
+  fprintf(stderr, "timer: virtual counter, %lu ticks/s\n", timer_frequency());
 }
 #elif TIMER == SHARED_MEMORY_TIMER
+#include <assert.h>
 #include <pthread.h>
+#include <sys/mman.h>
+#include <time.h>
 
-volatile uint64_t shared_counter = 0;
-pthread_t shared_memory_timer_thread;
+// The counters are mapped shared so that forked children keep seeing them being
+// updated by the counter threads in the parent.
+shared_counter_t* shared_counters = NULL;
+__thread const shared_counter_t* shared_counter = NULL;
 
-static void* shared_memory_timer_func(void* ignored) {
-  cpu_pin_to(SHARED_MEMORY_TIMER_CPU);
+// Bookkeeping is kept away from the counters, so that reading it never touches
+// a counter's cache lines.
+typedef struct {
+  pthread_t thread;
+  int cpu;
+  int measuring_cpu;
+  uint64_t ticks_per_second;
+} shared_timer_t;
+
+static pthread_mutex_t shared_timers_lock = PTHREAD_MUTEX_INITIALIZER;
+static shared_timer_t shared_timers[SHARED_MEMORY_TIMER_COUNTERS];
+static size_t shared_timer_count = 0;
+static cpu_set_t reserved_cpus;
+static bool reserved_cpus_initialized = false;
+static __thread size_t current_timer = 0;
+
+static void* shared_memory_timer_func(void* arg) {
+  size_t index = (size_t)arg;
+  shared_counter_t* counter = &shared_counters[index];
+  cpu_pin_to(shared_timers[index].cpu);
 
   while (true) {
-    ++shared_counter;
+    ++counter->value;
   }
 
   return NULL;
 }
 
-void start_timer() {
-  pthread_create(&shared_memory_timer_thread, NULL, &shared_memory_timer_func, NULL);
-  while (!shared_counter) {}
+static uint64_t measure_ticks_per_second(const shared_counter_t* counter) {
+  struct timespec start_time, end_time;
+  struct timespec delay = {0, 10 * 1000 * 1000};
+
+  clock_gettime(CLOCK_MONOTONIC, &start_time);
+  uint64_t start = counter->value;
+  nanosleep(&delay, NULL);
+  uint64_t end = counter->value;
+  clock_gettime(CLOCK_MONOTONIC, &end_time);
+
+  uint64_t elapsed_ns = (end_time.tv_sec - start_time.tv_sec) * 1000000000ull
+                        + end_time.tv_nsec - start_time.tv_nsec;
+  return ((end - start) * 1000000000ull) / elapsed_ns;
+}
+
+void timer_reserve_cpu(int core) {
+  pthread_mutex_lock(&shared_timers_lock);
+  if (!reserved_cpus_initialized) {
+    CPU_ZERO(&reserved_cpus);
+    reserved_cpus_initialized = true;
+  }
+  CPU_SET(core, &reserved_cpus);
+  pthread_mutex_unlock(&shared_timers_lock);
+}
+
+int start_timer(int measuring_cpu) {
+  pthread_mutex_lock(&shared_timers_lock);
+  assert(shared_timer_count < SHARED_MEMORY_TIMER_COUNTERS);
+  size_t index = shared_timer_count++;
+  if (!shared_counters) {
+    shared_counters = mmap(NULL,
+      sizeof(shared_counter_t) * SHARED_MEMORY_TIMER_COUNTERS,
+      PROT_READ|PROT_WRITE, MAP_ANONYMOUS|MAP_SHARED, -1, 0);
+    assert(shared_counters != MAP_FAILED);
+  }
+
+  // Keep clear of every core that is already measuring or counting.
+  cpu_set_t exclude;
+  CPU_ZERO(&exclude);
+  if (reserved_cpus_initialized) {
+    CPU_OR(&exclude, &exclude, &reserved_cpus);
+  }
+  for (size_t i = 0; i < index; ++i) {
+    CPU_SET(shared_timers[i].cpu, &exclude);
+    if (shared_timers[i].measuring_cpu >= 0) {
+      CPU_SET(shared_timers[i].measuring_cpu, &exclude);
+    }
+  }
+
+  int cpu = SHARED_MEMORY_TIMER_CPU;
+  if (cpu < 0 || index != 0) {
+    cpu = cpu_pick_spare(measuring_cpu, &exclude);
+  }
+  assert(cpu >= 0 && cpu != measuring_cpu);
+
+  shared_timers[index].cpu = cpu;
+  shared_timers[index].measuring_cpu = measuring_cpu;
+  pthread_create(&shared_timers[index].thread, NULL, &shared_memory_timer_func,
+                 (void*)index);
+  pthread_mutex_unlock(&shared_timers_lock);
+
+  while (!shared_counters[index].value) {}
+  shared_timers[index].ticks_per_second =
+      measure_ticks_per_second(&shared_counters[index]);
+
+  select_timer(index);
+  return index;
+}
+
+void select_timer(int index) {
+  current_timer = index;
+  shared_counter = &shared_counters[index];
+}
+
+uint64_t timer_frequency() {
+  return shared_timers[current_timer].ticks_per_second;
+}
+
+void print_timer_info() {
+  const shared_timer_t* timer = &shared_timers[current_timer];
+  fprintf(stderr, "timer: shared memory counter %zu on cpu %i, %lu ticks/s "
+                  "(%.2f ns/tick)\n",
+          current_timer, timer->cpu, timer->ticks_per_second,
+          1000000000.0 / (double)timer->ticks_per_second);
 }
 #endif
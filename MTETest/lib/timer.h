@@ -15,10 +15,35 @@
 #ifndef TIMER_H_
 #define TIMER_H_
 
-#include "aarch64.h"
+#include "arch.h"
 #include "config.h"
 
-void start_timer();
+#include <sched.h>
+
+// The most timers that start_timer can hand out in one process, ie. the most
+// cores that can be measured on at once.
+#if TIMER == SHARED_MEMORY_TIMER
+#define MAX_TIMERS ((size_t)SHARED_MEMORY_TIMER_COUNTERS)
+#else
+#define MAX_TIMERS ((size_t)CPU_SETSIZE)
+#endif
+
+// Starts the timer for the calling thread, which will take measurements on
+// measuring_cpu. Returns the index of the timer that the thread was given.
+int start_timer(int measuring_cpu);
+
+// Makes the calling thread use a timer previously returned by start_timer. The
+// timers are shared with child processes, so a process can start timers for
+// its workers before forking them.
+void select_timer(int index);
+
+// Keeps start_timer from placing timer threads on core, eg. because a worker
+// that hasn't started its timer yet is going to measure there.
+void timer_reserve_cpu(int core);
+
+// Effective tick rate of the calling thread's timer, in ticks per second.
+uint64_t timer_frequency();
+void print_timer_info();
 
 #if TIMER == VIRTUAL_TIMER
 __attribute__((always_inline))
@@ -37,20 +62,33 @@ static inline uint64_t read_latency(const void* ptr) {
   return end - start;
 }
 #elif TIMER == SHARED_MEMORY_TIMER
-extern volatile uint64_t shared_counter;
+// Each counter gets two cache lines to itself, since adjacent-line prefetchers
+// will otherwise pull in (and contend for) the neighbouring line.
+#define SHARED_COUNTER_ALIGNMENT (2 * CACHE_LINE_SIZE)
+
+typedef struct {
+  volatile uint64_t value;
+  char padding[SHARED_COUNTER_ALIGNMENT - sizeof(uint64_t)];
+} __attribute__((aligned(SHARED_COUNTER_ALIGNMENT))) shared_counter_t;
+
+extern shared_counter_t* shared_counters;
+extern __thread const shared_counter_t* shared_counter;
 
 __attribute__((always_inline))
 static inline uint64_t read_latency(const void* ptr) {
   const volatile uint64_t* read_ptr = (const volatile uint64_t*)ptr;
+  // Load the counter address up-front, so that it isn't reloaded inside the
+  // timed region.
+  const volatile uint64_t* counter = &shared_counter->value;
   uint64_t start, end;
 
   local_memory_barrier();
   instruction_barrier();
-  start = shared_counter;
+  start = *counter;
   read_ptr = (const volatile uint64_t*)*read_ptr;
   local_memory_barrier();
   instruction_barrier();
-  end = shared_counter;
+  end = *counter;
 
   return end - start;
 }
@@ -0,0 +1,80 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tuning.h"
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+typedef struct {
+  uint64_t core_type;
+  uint64_t value;
+} tuning_entry_t;
+
+static size_t read_entries(const char* path, tuning_entry_t* entries) {
+  FILE* file = fopen(path, "r");
+  if (!file) {
+    return 0;
+  }
+  size_t count = 0;
+  while (count < TUNING_MAX_ENTRIES
+         && 2 == fscanf(file, "%" SCNx64 " %" SCNu64, &entries[count].core_type,
+                        &entries[count].value)) {
+    count += 1;
+  }
+  fclose(file);
+  return count;
+}
+
+bool tuning_load(const char* path, uint64_t core_type, uint64_t* value) {
+  tuning_entry_t entries[TUNING_MAX_ENTRIES];
+  size_t count = read_entries(path, entries);
+  for (size_t i = 0; i < count; ++i) {
+    if (entries[i].core_type == core_type) {
+      *value = entries[i].value;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool tuning_save(const char* path, uint64_t core_type, uint64_t value) {
+  tuning_entry_t entries[TUNING_MAX_ENTRIES];
+  size_t count = read_entries(path, entries);
+  size_t i = 0;
+  while (i < count && entries[i].core_type != core_type) {
+    ++i;
+  }
+  if (i == TUNING_MAX_ENTRIES) {
+    fprintf(stderr, "%s: too many core types\n", path);
+    return false;
+  }
+  entries[i].core_type = core_type;
+  entries[i].value = value;
+  if (i == count) {
+    count += 1;
+  }
+
+  FILE* file = fopen(path, "w");
+  if (!file) {
+    fprintf(stderr, "can't write tuning file %s: %s\n", path, strerror(errno));
+    return false;
+  }
+  for (i = 0; i < count; ++i) {
+    fprintf(file, "%#" PRIx64 " %" PRIu64 "\n", entries[i].core_type, entries[i].value);
+  }
+  return 0 == fclose(file);
+}
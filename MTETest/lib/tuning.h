@@ -0,0 +1,30 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TUNING_H_
+#define TUNING_H_
+
+#include "config.h"
+
+// Tuned values that depend on the core model, eg. the number of branch
+// predictor iterations found by speculation_window -T. These are stored as
+// "core_type value" lines in a text file, keyed by cpu_type_of.
+
+#define TUNING_MAX_ENTRIES ((size_t)64)
+
+bool tuning_load(const char* path, uint64_t core_type, uint64_t* value);
+// Returns false, having said why, if the file can't be written.
+bool tuning_save(const char* path, uint64_t core_type, uint64_t value);
+
+#endif // TUNING_H_
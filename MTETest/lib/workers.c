@@ -0,0 +1,62 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "workers.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "scheduler.h"
+
+void* map_shared(size_t size) {
+  void* ptr = mmap(NULL, size, PROT_READ|PROT_WRITE,
+    MAP_ANONYMOUS|MAP_SHARED, -1, 0);
+  assert(ptr != MAP_FAILED);
+  return ptr;
+}
+
+size_t run_workers(const int* cpus, size_t count, worker_function_t function, void* arg) {
+  pid_t* pids = calloc(count, sizeof(pid_t));
+  assert(pids);
+
+  // Anything still buffered would otherwise be written once by every worker.
+  fflush(NULL);
+
+  for (size_t i = 0; i < count; ++i) {
+    pids[i] = fork();
+    assert(pids[i] >= 0);
+    if (!pids[i]) {
+      cpu_pin_to(cpus[i]);
+      function(i, cpus[i], arg);
+      fflush(NULL);
+      _exit(0);
+    }
+  }
+
+  size_t failures = 0;
+  for (size_t i = 0; i < count; ++i) {
+    int status = 0;
+    assert(pids[i] == waitpid(pids[i], &status, 0));
+    if (!WIFEXITED(status) || WEXITSTATUS(status)) {
+      fprintf(stderr, "worker on cpu %i failed (status %i)\n", cpus[i], status);
+      ++failures;
+    }
+  }
+
+  free(pids);
+  return failures;
+}
@@ -0,0 +1,31 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef WORKERS_H_
+#define WORKERS_H_
+
+#include "config.h"
+
+typedef void (*worker_function_t)(size_t index, int cpu, void* arg);
+
+// Maps memory that stays shared between the caller and the workers it forks,
+// for collecting results from them.
+void* map_shared(size_t size);
+
+// Forks one worker process per core in cpus, pins each one to its core and runs
+// function(index, cpu, arg) in it. Waits for all of the workers to exit, and
+// returns the number of workers that failed.
+size_t run_workers(const int* cpus, size_t count, worker_function_t function, void* arg);
+
+#endif // WORKERS_H_
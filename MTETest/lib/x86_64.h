@@ -0,0 +1,87 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef X86_64_H_
+#define X86_64_H_
+
+#include <time.h>
+
+#define CACHE_LINE_SIZE ((size_t)64)
+
+// lfence doesn't let any later instruction begin execution until all earlier
+// instructions have completed, which is the property the tests need from isb.
+__attribute__((always_inline))
+inline void instruction_barrier() {
+  asm volatile ("lfence":::"memory");
+}
+
+__attribute__((always_inline))
+inline void system_memory_barrier() {
+  asm volatile ("mfence":::"memory");
+}
+
+__attribute__((always_inline))
+inline void local_memory_barrier() {
+  asm volatile ("mfence":::"memory");
+}
+
+// clflushopt is only ordered by fences, but the tests always fence around
+// flushes anyway.
+__attribute__((always_inline))
+inline void flush_data_cache(void* ptr) {
+#ifdef __CLFLUSHOPT__
+  asm volatile ("clflushopt (%0)"::"r"(ptr):"memory");
+#else
+  asm volatile ("clflush (%0)"::"r"(ptr):"memory");
+#endif
+}
+
+// The instruction cache is coherent with data writes on x86, so newly written
+// code only needs a serialising instruction before it runs.
+__attribute__((always_inline))
+inline void flush_instruction_cache(void* ptr, size_t size) {
+  (void)ptr;
+  (void)size;
+  uint32_t eax = 0, ebx, ecx = 0, edx;
+  asm volatile ("cpuid":"+a"(eax), "=b"(ebx), "+c"(ecx), "=d"(edx)::"memory");
+}
+
+__attribute__((always_inline))
+inline uint64_t virtual_count() {
+  uint32_t low, high;
+  asm volatile ("rdtsc":"=a"(low), "=d"(high));
+  return ((uint64_t)high << 32) | low;
+}
+
+// There's no architectural way to read the TSC frequency from userspace, so
+// measure it against CLOCK_MONOTONIC the first time it's needed.
+static inline uint64_t virtual_frequency() {
+  static uint64_t frequency = 0;
+  if (!frequency) {
+    struct timespec start_time, end_time;
+    uint64_t elapsed;
+    clock_gettime(CLOCK_MONOTONIC, &start_time);
+    uint64_t start = virtual_count();
+    do {
+      clock_gettime(CLOCK_MONOTONIC, &end_time);
+      elapsed = (end_time.tv_sec - start_time.tv_sec) * 1000000000ull
+                + end_time.tv_nsec - start_time.tv_nsec;
+    } while (elapsed < 10000000ull);
+    uint64_t end = virtual_count();
+    frequency = (end - start) * 1000000000ull / elapsed;
+  }
+  return frequency;
+}
+
+#endif // X86_64_H_
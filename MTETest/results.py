@@ -0,0 +1,45 @@
+#! /usr/bin/python3
+
+# Copyright 2023 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     https://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import csv
+import os
+import subprocess
+import tempfile
+
+
+RESULTS_SUMMARY = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                               'results_summary')
+SUMMARY_FLOAT_COLUMNS = {'distance'}
+
+
+# Summarise results files (or directories of them) using the results_summary
+# host tool built by build.sh. thresholds maps cpu to the latency below which
+# a load counts as a cache hit. Returns a dict mapping (cpu, nop_count) to a
+# summary row.
+def summarise(paths, thresholds={}):
+  args = [RESULTS_SUMMARY]
+  for cpu, threshold in thresholds.items():
+    args += ['-t', f'{cpu}:{threshold}']
+  with tempfile.NamedTemporaryFile(mode='r', suffix='.csv') as output:
+    subprocess.run(args + [output.name] + paths, check=True)
+    rows = list(csv.DictReader(output))
+
+  summary = {}
+  for row in rows:
+    row = {name: float(value) if name in SUMMARY_FLOAT_COLUMNS else int(value)
+           for name, value in row.items()}
+    summary[(row['cpu'], row['nop_count'])] = row
+  return summary
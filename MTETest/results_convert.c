@@ -0,0 +1,108 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Host-side converter for the binary results files written by the tests, eg.
+// speculation_window -o. This writes either a CSV file, or one raw
+// little-endian array per field, which numpy/pyarrow can load directly (eg.
+// np.fromfile(path, dtype='<u4')) to build a Parquet file or DataFrame.
+
+#define _GNU_SOURCE
+
+#include <assert.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "lib/results.h"
+
+int main(int argc, char** argv) {
+  if (argc != 4 || (strcmp(argv[2], "csv") && strcmp(argv[2], "columns"))) {
+    fprintf(stderr, "usage: results_convert results_file csv output_file\n");
+    fprintf(stderr, "       results_convert results_file columns output_prefix\n");
+    exit(-1);
+  }
+
+  int fd = open(argv[1], O_RDONLY);
+  results_header_t header;
+  if (fd < 0 || !results_read_header(fd, &header)) {
+    fprintf(stderr, "%s is not a results file\n", argv[1]);
+    exit(-1);
+  }
+  bool csv = !strcmp(argv[2], "csv");
+
+  FILE* outputs[RESULT_FIELD_COUNT] = {0};
+  if (csv) {
+    outputs[0] = fopen(argv[3], "w");
+    assert(outputs[0]);
+    for (size_t i = 0; i < header.field_count; ++i) {
+      fprintf(outputs[0], "%s%.*s", i ? "," : "",
+              (int)sizeof(header.fields[i].name), header.fields[i].name);
+    }
+    fprintf(outputs[0], "\n");
+  } else {
+    for (size_t i = 0; i < header.field_count; ++i) {
+      char* path;
+      asprintf(&path, "%s.%.*s.bin", argv[3],
+               (int)sizeof(header.fields[i].name), header.fields[i].name);
+      outputs[i] = fopen(path, "wb");
+      assert(outputs[i]);
+      printf("%s: <u%u\n", path, header.fields[i].type);
+      free(path);
+    }
+  }
+
+  size_t total_records = 0;
+  size_t records;
+  uint8_t* buffer = malloc(header.record_size * RESULTS_BUFFER_RECORDS);
+  assert(buffer);
+  while ((records = results_read_records(fd, buffer, header.record_size,
+                                         RESULTS_BUFFER_RECORDS))) {
+    for (size_t i = 0; i < records; ++i) {
+      const uint8_t* record = buffer + i * header.record_size;
+      for (size_t j = 0; j < header.field_count; ++j) {
+        uint64_t value = results_field_value(record, &header.fields[j]);
+        if (csv) {
+          fprintf(outputs[0], j ? ",%" PRIu64 : "%" PRIu64, value);
+        } else {
+          fwrite(&value, header.fields[j].type, 1, outputs[j]);
+        }
+      }
+      if (csv) {
+        fputc('\n', outputs[0]);
+      }
+    }
+    total_records += records;
+  }
+
+  for (size_t i = 0; i < RESULT_FIELD_COUNT; ++i) {
+    if (outputs[i]) {
+      fclose(outputs[i]);
+    }
+  }
+  free(buffer);
+  close(fd);
+
+  fprintf(stderr, "converted %zu records (timer %" PRIu64 " ticks/s, seed %" PRIu64 ")\n",
+          total_records, header.timer_frequency, header.seed);
+  for (size_t i = 0; i < header.calibration_count; ++i) {
+    const result_calibration_t* calibration = &header.calibrations[i];
+    fprintf(stderr, "cpu %u calibration: threshold %" PRIu64 ", hit latency %" PRIu64
+            ", miss latency %" PRIu64 "\n", calibration->cpu, calibration->threshold,
+            calibration->hit_latency, calibration->miss_latency);
+  }
+  return 0;
+}
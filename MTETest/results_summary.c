@@ -0,0 +1,375 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Host-side summary of the binary results files written by speculation_window.
+// This streams through any number of results files, counts latencies into one
+// distribution per (cpu, nop_count, tag_match), and writes one CSV line per
+// (cpu, nop_count) with the number of cache hits, medians and how well the
+// tag check pass and fail latencies are separated. Samples from disturbed
+// batches (see lib/noise.h) are skipped. Memory use depends only on
+// the number of configurations, not on the number of records, so this keeps
+// up with however much data has been collected.
+
+#define _GNU_SOURCE
+
+#include <assert.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "lib/distribution.h"
+#include "lib/results.h"
+
+#define MAX_THRESHOLDS ((size_t)256)
+
+typedef struct {
+  bool used;
+  uint64_t cpu;
+  uint64_t nop_count;
+  // Indexed by whether the tag check passed.
+  distribution_t latencies[2];
+} bucket_t;
+
+typedef struct {
+  bucket_t* buckets;
+  size_t capacity;
+  size_t count;
+} table_t;
+
+typedef struct {
+  uint64_t cpu;
+  uint64_t latency;
+} threshold_t;
+
+static table_t table;
+static threshold_t thresholds[MAX_THRESHOLDS];
+static size_t threshold_count;
+// Thresholds from the calibrations in the results headers, where the first
+// file to calibrate a cpu wins.
+static threshold_t calibrated_thresholds[MAX_THRESHOLDS];
+static size_t calibrated_threshold_count;
+static size_t total_records;
+static size_t disturbed_records;
+static size_t demoted_records;
+
+static size_t bucket_index(uint64_t cpu, uint64_t nop_count, size_t capacity) {
+  uint64_t hash = (cpu * 0x9e3779b97f4a7c15ull) ^ (nop_count * 0xc2b2ae3d27d4eb4full);
+  return (hash ^ (hash >> 32)) & (capacity - 1);
+}
+
+static bucket_t* table_insert(bucket_t* buckets, size_t capacity,
+                              uint64_t cpu, uint64_t nop_count) {
+  size_t i = bucket_index(cpu, nop_count, capacity);
+  while (buckets[i].used
+         && (buckets[i].cpu != cpu || buckets[i].nop_count != nop_count)) {
+    i = (i + 1) & (capacity - 1);
+  }
+  return &buckets[i];
+}
+
+static void table_grow() {
+  size_t capacity = table.capacity ? table.capacity * 2 : 64;
+  bucket_t* buckets = calloc(capacity, sizeof(bucket_t));
+  assert(buckets);
+  for (size_t i = 0; i < table.capacity; ++i) {
+    if (table.buckets[i].used) {
+      bucket_t* bucket = table_insert(buckets, capacity, table.buckets[i].cpu,
+                                      table.buckets[i].nop_count);
+      memcpy(bucket, &table.buckets[i], sizeof(bucket_t));
+    }
+  }
+  free(table.buckets);
+  table.buckets = buckets;
+  table.capacity = capacity;
+}
+
+static bucket_t* table_find(uint64_t cpu, uint64_t nop_count) {
+  if ((table.count + 1) * 2 > table.capacity) {
+    table_grow();
+  }
+  bucket_t* bucket = table_insert(table.buckets, table.capacity, cpu, nop_count);
+  if (!bucket->used) {
+    bucket->used = true;
+    bucket->cpu = cpu;
+    bucket->nop_count = nop_count;
+    table.count += 1;
+  }
+  return bucket;
+}
+
+static int compare_buckets(const void* lhs, const void* rhs) {
+  const bucket_t* lhs_bucket = *(const bucket_t**)lhs;
+  const bucket_t* rhs_bucket = *(const bucket_t**)rhs;
+  if (lhs_bucket->cpu != rhs_bucket->cpu) {
+    return lhs_bucket->cpu < rhs_bucket->cpu ? -1 : 1;
+  }
+  if (lhs_bucket->nop_count != rhs_bucket->nop_count) {
+    return lhs_bucket->nop_count < rhs_bucket->nop_count ? -1 : 1;
+  }
+  return 0;
+}
+
+static bool find_threshold(const threshold_t* table, size_t count,
+                           uint64_t cpu, uint64_t* latency) {
+  for (size_t i = 0; i < count; ++i) {
+    if (table[i].cpu == cpu) {
+      *latency = table[i].latency;
+      return true;
+    }
+  }
+  return false;
+}
+
+// Returns false if path isn't a results file.
+static bool summarise_file(const char* path) {
+  int fd = open(path, O_RDONLY);
+  results_header_t header;
+  if (fd < 0 || !results_read_header(fd, &header)) {
+    if (fd >= 0) {
+      close(fd);
+    }
+    return false;
+  }
+
+  int cpu_field = results_find_field(&header, "cpu");
+  int tag_match_field = results_find_field(&header, "tag_match");
+  int nop_count_field = results_find_field(&header, "nop_count");
+  int latency_field = results_find_field(&header, "latency");
+  int flags_field = results_find_field(&header, "flags");
+  if (cpu_field < 0 || tag_match_field < 0 || nop_count_field < 0 || latency_field < 0) {
+    fprintf(stderr, "%s: missing speculation_window fields\n", path);
+    close(fd);
+    return true;
+  }
+
+  for (size_t i = 0; i < header.calibration_count; ++i) {
+    const result_calibration_t* calibration = &header.calibrations[i];
+    uint64_t latency;
+    if (calibrated_threshold_count < MAX_THRESHOLDS
+        && !find_threshold(calibrated_thresholds, calibrated_threshold_count,
+                           calibration->cpu, &latency)) {
+      threshold_t* threshold = &calibrated_thresholds[calibrated_threshold_count++];
+      threshold->cpu = calibration->cpu;
+      threshold->latency = calibration->threshold;
+    }
+  }
+
+  static uint8_t* buffer;
+  static size_t buffer_size;
+  if (buffer_size < header.record_size * RESULTS_BUFFER_RECORDS) {
+    buffer_size = header.record_size * RESULTS_BUFFER_RECORDS;
+    buffer = realloc(buffer, buffer_size);
+    assert(buffer);
+  }
+
+  // Consecutive records almost always come from the same configuration.
+  bucket_t* bucket = NULL;
+  size_t records;
+  while ((records = results_read_records(fd, buffer, header.record_size,
+                                         RESULTS_BUFFER_RECORDS))) {
+    for (size_t i = 0; i < records; ++i) {
+      const uint8_t* record = buffer + i * header.record_size;
+      uint64_t flags = flags_field >= 0
+          ? results_field_value(record, &header.fields[flags_field]) : 0;
+      if (flags & RESULT_FLAG_DISTURBED) {
+        disturbed_records += 1;
+        continue;
+      }
+      demoted_records += (flags & RESULT_FLAG_DEMOTED) != 0;
+      uint64_t cpu = results_field_value(record, &header.fields[cpu_field]);
+      uint64_t nop_count = results_field_value(record, &header.fields[nop_count_field]);
+      if (!bucket || bucket->cpu != cpu || bucket->nop_count != nop_count) {
+        bucket = table_find(cpu, nop_count);
+      }
+      uint64_t tag_match = results_field_value(record, &header.fields[tag_match_field]);
+      distribution_add(&bucket->latencies[tag_match != 0],
+                       results_field_value(record, &header.fields[latency_field]));
+    }
+    total_records += records;
+  }
+
+  close(fd);
+  return true;
+}
+
+// Summarises every results file under a directory, skipping anything else.
+static void summarise_directory(const char* path) {
+  DIR* dir = opendir(path);
+  if (!dir) {
+    fprintf(stderr, "%s: can't open directory\n", path);
+    return;
+  }
+
+  struct dirent* entry;
+  while ((entry = readdir(dir))) {
+    if (entry->d_name[0] == '.') {
+      continue;
+    }
+    char* entry_path;
+    assert(0 < asprintf(&entry_path, "%s/%s", path, entry->d_name));
+    struct stat entry_stat;
+    if (!stat(entry_path, &entry_stat)) {
+      if (S_ISDIR(entry_stat.st_mode)) {
+        summarise_directory(entry_path);
+      } else if (S_ISREG(entry_stat.st_mode)) {
+        summarise_file(entry_path);
+      }
+    }
+    free(entry_path);
+  }
+  closedir(dir);
+}
+
+static void write_summary(FILE* output, FILE* histogram_output) {
+  bucket_t** buckets = malloc(sizeof(bucket_t*) * (table.count + 1));
+  assert(buckets);
+  size_t count = 0;
+  for (size_t i = 0; i < table.capacity; ++i) {
+    if (table.buckets[i].used) {
+      buckets[count++] = &table.buckets[i];
+    }
+  }
+  qsort(buckets, count, sizeof(bucket_t*), compare_buckets);
+
+  fprintf(output, "cpu,nop_count,threshold,fail_count,fail_hits,fail_median,"
+                  "pass_count,pass_hits,pass_median,distance\n");
+  if (histogram_output) {
+    fprintf(histogram_output, "cpu,tag_match,nop_count,latency,count\n");
+  }
+
+  size_t start = 0;
+  while (start < count) {
+    uint64_t cpu = buckets[start]->cpu;
+    size_t end = start;
+    while (end < count && buckets[end]->cpu == cpu) {
+      ++end;
+    }
+
+    // Without a threshold or calibration for this cpu, split its latencies into
+    // cache hits and misses.
+    uint64_t threshold;
+    if (!find_threshold(thresholds, threshold_count, cpu, &threshold)
+        && !find_threshold(calibrated_thresholds, calibrated_threshold_count,
+                           cpu, &threshold)) {
+      distribution_t pooled;
+      distribution_reset(&pooled);
+      for (size_t i = start; i < end; ++i) {
+        distribution_merge(&pooled, &buckets[i]->latencies[0]);
+        distribution_merge(&pooled, &buckets[i]->latencies[1]);
+      }
+      threshold = distribution_split(&pooled);
+    }
+
+    for (size_t i = start; i < end; ++i) {
+      const distribution_t* latencies = buckets[i]->latencies;
+      fprintf(output, "%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64
+                      ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%.6f\n",
+              cpu, buckets[i]->nop_count, threshold,
+              latencies[0].total, distribution_count_below(&latencies[0], threshold),
+              distribution_percentile(&latencies[0], 50),
+              latencies[1].total, distribution_count_below(&latencies[1], threshold),
+              distribution_percentile(&latencies[1], 50),
+              distribution_distance(&latencies[0], &latencies[1]));
+
+      for (size_t tag_match = 0; histogram_output && tag_match < 2; ++tag_match) {
+        for (size_t latency = 0; latency < DISTRIBUTION_BINS; ++latency) {
+          if (latencies[tag_match].counts[latency]) {
+            fprintf(histogram_output, "%" PRIu64 ",%zu,%" PRIu64 ",%zu,%" PRIu64 "\n",
+                    cpu, tag_match, buckets[i]->nop_count, latency,
+                    latencies[tag_match].counts[latency]);
+          }
+        }
+      }
+    }
+    start = end;
+  }
+
+  free(buckets);
+}
+
+static void usage() {
+  fprintf(stderr, "usage: results_summary [-t cpu:threshold]... [-H histogram_file] output_file results_path...\n");
+  fprintf(stderr, "  results_path is a results file, or a directory to search for results files\n");
+  fprintf(stderr, "  -t sets the cache hit latency threshold for a cpu, which is otherwise\n");
+  fprintf(stderr, "     taken from the calibration in the results files, or chosen to split\n");
+  fprintf(stderr, "     that cpu's latencies into two classes\n");
+  exit(-1);
+}
+
+int main(int argc, char** argv) {
+  const char* histogram_path = NULL;
+
+  int opt;
+  while ((opt = getopt(argc, argv, "t:H:")) != -1) {
+    switch (opt) {
+      case 't': {
+        threshold_t* threshold = &thresholds[threshold_count];
+        if (threshold_count == MAX_THRESHOLDS
+            || 2 != sscanf(optarg, "%" SCNu64 ":%" SCNu64, &threshold->cpu,
+                           &threshold->latency)) {
+          usage();
+        }
+        threshold_count += 1;
+        break;
+      }
+      case 'H':
+        histogram_path = optarg;
+        break;
+      default:
+        usage();
+    }
+  }
+
+  if (argc - optind < 2) {
+    usage();
+  }
+
+  for (int i = optind + 1; i < argc; ++i) {
+    struct stat path_stat;
+    if (!stat(argv[i], &path_stat) && S_ISDIR(path_stat.st_mode)) {
+      summarise_directory(argv[i]);
+    } else if (!summarise_file(argv[i])) {
+      fprintf(stderr, "%s is not a results file\n", argv[i]);
+      exit(-1);
+    }
+  }
+
+  FILE* output = fopen(argv[optind], "w");
+  assert(output);
+  FILE* histogram_output = NULL;
+  if (histogram_path) {
+    histogram_output = fopen(histogram_path, "w");
+    assert(histogram_output);
+  }
+
+  write_summary(output, histogram_output);
+
+  fclose(output);
+  if (histogram_output) {
+    fclose(histogram_output);
+  }
+
+  fprintf(stderr, "summarised %zu records in %zu configurations, skipped %zu disturbed\n",
+          total_records - disturbed_records, table.count, disturbed_records);
+  if (demoted_records) {
+    fprintf(stderr, "warning: %zu of the summarised records were taken after the watchdog "
+                    "dropped SCHED_FIFO priority\n", demoted_records);
+  }
+  return 0;
+}
@@ -36,9 +36,9 @@ int main(int argc, char** argv) {
   // In async MTE mode, the kernel does not catch invalid accesses to userspace
   // pointers. This is documented behaviour:
   // https://elixir.bootlin.com/linux/v5.18.9/source/Documentation/arm64/memory-tagging-extension.rst#L111
-  memset(tagged_ptr, 0x23, 0x1000);
+  memset(mte_access(tagged_ptr, 0x1000), 0x23, 0x1000);
   int fd = open("/dev/urandom", O_RDONLY);
   fprintf(stderr, "%p %p\n", ptr, tagged_ptr);
-  read(fd, ptr, 0x1000);
-  assert(*tagged_ptr == 0x2323232323232323ull);
+  read(fd, mte_syscall_ptr(ptr, 0x1000), 0x1000);
+  assert(mte_load64(tagged_ptr) == 0x2323232323232323ull);
 }
@@ -28,17 +28,6 @@
 
 #include "lib/mte.h"
 
-#define DEFAULT_TAG_MASK ((uint16_t)0xfffe)
-
-void* _mte_tag(void* ptr, size_t len) {
-  asm volatile ("irg %0, %0\n" : "+r"(ptr));
-  void* end_ptr = ptr;
-  for (size_t i = 0; i < len; i += 16) {
-    asm volatile ("stg %0, [%0], #16\n" : "+r"(end_ptr));
-  }
-  return ptr;
-}
-
 size_t readn(int fd, void* ptr, size_t len) {
   char* start_ptr = ptr;
   char* read_ptr = ptr;
@@ -60,8 +49,8 @@ int main(int argc, char** argv) {
   mte_enable(true, DEFAULT_TAG_MASK);
   char* ptr = mmap(NULL, 0x1000,
     PROT_READ|PROT_WRITE|PROT_MTE, MAP_ANONYMOUS|MAP_PRIVATE, -1, 0);
-  ptr = _mte_tag(ptr, 0x10);
-  strcpy(ptr, "AAAAAAAAAAAAAAA");
+  ptr = mte_tag(ptr, 0x10);
+  strcpy(mte_access(ptr, 0x10), "AAAAAAAAAAAAAAA");
 
   int pipefd[2];
   assert(!pipe(pipefd));
@@ -73,15 +62,16 @@ int main(int argc, char** argv) {
   // critical error.
 
   char* new_ptr = ptr;
-  while (!strcmp(new_ptr, "AAAAAAAAAAAAAAA")) {
+  while (!strcmp(mte_access(new_ptr, 0x10), "AAAAAAAAAAAAAAA")) {
     // Simulate a use-after-free, where new_ptr is repeatedly free'd and ptr
     // is accessed after the free via a syscall.
-    new_ptr = _mte_tag(new_ptr, 0x10);
-    strcpy(new_ptr, "AAAAAAAAAAAAAAA");
+    new_ptr = mte_tag(new_ptr, 0x10);
+    strcpy(mte_access(new_ptr, 0x10), "AAAAAAAAAAAAAAA");
 
     // The use of ptr in the next statement is modelling a use-after-free.
-    size_t bytes_read = readn(pipefd[0], ptr, 0x10);
-    fprintf(stderr, "read %zu bytes\nnew_ptr string is %s\n", bytes_read, new_ptr);
+    size_t bytes_read = readn(pipefd[0], mte_syscall_ptr(ptr, 0x10), 0x10);
+    fprintf(stderr, "read %zu bytes\nnew_ptr string is %s\n", bytes_read,
+            (char*)mte_access(new_ptr, 0x10));
 
     if (ptr == new_ptr) {
       break;
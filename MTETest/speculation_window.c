@@ -14,54 +14,76 @@
 
 #define _GNU_SOURCE
 
+#include <assert.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <fcntl.h>
+#include <getopt.h>
+#include <inttypes.h>
+#include <sys/wait.h>
 #include <time.h>
 #include <unistd.h>
 
 #include "config.h"
-#include "lib/aarch64.h"
+#include "lib/arch.h"
+#include "lib/classifier.h"
+#include "lib/distribution.h"
+#include "lib/environment.h"
 #include "lib/histogram.h"
 #include "lib/mte.h"
+#include "lib/noise.h"
 #include "lib/perf_counters.h"
+#include "lib/results.h"
 #include "lib/scheduler.h"
 #include "lib/timer.h"
+#include "lib/tuning.h"
+#include "lib/workers.h"
 
-#define CODE_INSTRUCTIONS ((size_t)0x400)
-#define CODE_SIZE (CODE_MAX_INSTRUCTIONS * sizeof(uint32_t))
-
-__attribute__((aligned(0x1000)))
-uint32_t code[CODE_INSTRUCTIONS];
-uint32_t* code_ptr;
+// All of the code variants are generated once up-front into a single arena, so
+// that the test loop doesn't need to make any syscalls or do any cache
+// maintenance. Each variant starts on a new cache line.
+uint8_t* code_arena = NULL;
+size_t code_arena_size = 0;
+uint8_t* code_ptr;
 
 __attribute__((noinline))
-void code_start(uint32_t nop_instruction) {
-  mprotect(code, sizeof(code), PROT_READ|PROT_WRITE);
-  for (size_t i = 0; i < CODE_INSTRUCTIONS; ++i) {
-    code[i] = nop_instruction;
-  }
-  code_ptr = code;
+void code_start(size_t size) {
+  code_arena_size = (size + 0xfff) & ~(size_t)0xfff;
+  code_arena = mmap(NULL, code_arena_size, PROT_READ|PROT_WRITE,
+    MAP_ANONYMOUS|MAP_PRIVATE, -1, 0);
+  assert(code_arena != MAP_FAILED);
+  code_ptr = code_arena;
 }
 
 __attribute__((noinline))
-void code_emit(uint32_t instruction) {
-  *code_ptr = instruction;
-  code_ptr += 1;
+void code_emit_bytes(const void* code, size_t size) {
+  assert(code_ptr + size <= code_arena + code_arena_size);
+  memcpy(code_ptr, code, size);
+  code_ptr += size;
 }
 
 __attribute__((noinline))
-void code_skip(size_t count) {
-  code_ptr += count;
+void code_align(const void* fill, size_t fill_size) {
+  while ((code_ptr - code_arena) % CACHE_LINE_SIZE) {
+    code_emit_bytes(fill, fill_size);
+  }
 }
 
 __attribute__((noinline))
 void code_finish() {
-  mprotect(code, sizeof(code), PROT_READ|PROT_EXEC);
-  flush_instruction_cache(code, sizeof(code));
+  mprotect(code_arena, code_arena_size, PROT_READ|PROT_EXEC);
+  flush_instruction_cache(code_arena, code_arena_size);
 }
 
+typedef void (*function)(void*, void*, void*);
+
+function* code_variants = NULL;
+size_t code_variants_start = 0;
+// Indexed by whether timing_ptr is cached, see generate_calibration_variant.
+function calibration_variants[2];
+
+#if defined(__aarch64__)
 const uint32_t cbnz_x0_c    = 0xb5000060;
 const uint32_t ldr_x0_x0    = 0xf9400000;
 const uint32_t ldr_x1_x1    = 0xf9400021;
@@ -70,31 +92,131 @@ const uint32_t orr_x1_x2_x1 = 0xaa010041;
 const uint32_t ret          = 0xd65f03c0;
 const uint32_t bkpt         = 0xd4200000;
 
-typedef void (*function)(void*, void*, void*);
-const function code_function = (void(*)(void*,void*,void*))(code);
+// Size of a variant other than the nops, and of each nop.
+#define CODE_VARIANT_OVERHEAD (8 * sizeof(uint32_t))
+#define CODE_NOP_SIZE sizeof(uint32_t)
 
-__attribute__((noinline))
-void generate_code(size_t nop_count) {
-  // Generate our test code
+static void code_emit(uint32_t instruction) {
+  code_emit_bytes(&instruction, sizeof(instruction));
+}
 
+__attribute__((noinline))
+function generate_variant(size_t nop_count) {
   // Ideally we would offset the loads to prevent kernel noise from having those
   // pointers sitting around in registers, but they anyway need to be there for
   // the cache flushes, so there's not much point.
 
-  code_start(orr_x1_x2_x1);
+  code_align(&bkpt, sizeof(bkpt));
+  function variant = (function)code_ptr;
   code_emit(ldr_x0_x0);      // slow load
   code_emit(cbnz_x0_c);      // branch based on loaded value
   code_emit(ret);            //   -> correct branch = return
   code_emit(bkpt);           // stop straight-line speculation
                              //   -> incorrect branch
   code_emit(ldr_x1_x1);      // fast load from tagged memory
-  code_skip(nop_count);      // avoid a branch here based on nop_count
-  //for (size_t i = 0; i < nop_count; ++i) {
-  //  code_emit(orr_x1_x2_x1); // nops that propagate data dependency on x1
-  //}
+  for (size_t i = 0; i < nop_count; ++i) {
+    code_emit(orr_x1_x2_x1); // nops that propagate data dependency on x1
+  }
   code_emit(ldr_x2_x2);      // load from timing_ptr_1
   code_emit(ret);
   code_emit(bkpt);
+  return variant;
+}
+
+// The gadget without the load from timing_ptr, for calibration. With cached,
+// timing_ptr is instead loaded up-front, so that it's known to be cached when
+// the latency is read, rather than known to be uncached.
+__attribute__((noinline))
+function generate_calibration_variant(bool cached) {
+  code_align(&bkpt, sizeof(bkpt));
+  function variant = (function)code_ptr;
+  if (cached) {
+    code_emit(ldr_x2_x2);    // load from timing_ptr_1
+  }
+  code_emit(ldr_x0_x0);      // slow load
+  code_emit(cbnz_x0_c);      // branch based on loaded value
+  code_emit(ret);
+  code_emit(bkpt);
+  code_emit(ldr_x1_x1);      // fast load from tagged memory
+  code_emit(ret);
+  code_emit(bkpt);
+  return variant;
+}
+#elif defined(__x86_64__)
+// The same gadget for x86_64, with the arguments in rdi, rsi and rdx.
+const uint8_t mov_rax_rdi[] = {0x48, 0x8b, 0x07};
+const uint8_t test_rax_rax[] = {0x48, 0x85, 0xc0};
+const uint8_t jnz_2[]       = {0x75, 0x02};
+const uint8_t mov_rsi_rsi[] = {0x48, 0x8b, 0x36};
+const uint8_t or_rsi_rdx[]  = {0x48, 0x09, 0xd6};
+const uint8_t mov_rdx_rdx[] = {0x48, 0x8b, 0x12};
+const uint8_t ret[]         = {0xc3};
+const uint8_t int3[]        = {0xcc};
+
+#define CODE_VARIANT_OVERHEAD ((size_t)18)
+#define CODE_NOP_SIZE sizeof(or_rsi_rdx)
+
+#define code_emit(code) code_emit_bytes(code, sizeof(code))
+
+__attribute__((noinline))
+function generate_variant(size_t nop_count) {
+  code_align(int3, sizeof(int3));
+  function variant = (function)code_ptr;
+  code_emit(mov_rax_rdi);    // slow load
+  code_emit(test_rax_rax);
+  code_emit(jnz_2);          // branch based on loaded value
+  code_emit(ret);            //   -> correct branch = return
+  code_emit(int3);           // stop straight-line speculation
+                             //   -> incorrect branch
+  code_emit(mov_rsi_rsi);    // fast load from tagged memory
+  for (size_t i = 0; i < nop_count; ++i) {
+    code_emit(or_rsi_rdx);   // nops that propagate data dependency on rsi
+  }
+  code_emit(mov_rdx_rdx);    // load from timing_ptr_1
+  code_emit(ret);
+  code_emit(int3);
+  return variant;
+}
+
+__attribute__((noinline))
+function generate_calibration_variant(bool cached) {
+  code_align(int3, sizeof(int3));
+  function variant = (function)code_ptr;
+  if (cached) {
+    code_emit(mov_rdx_rdx);  // load from timing_ptr_1
+  }
+  code_emit(mov_rax_rdi);    // slow load
+  code_emit(test_rax_rax);
+  code_emit(jnz_2);          // branch based on loaded value
+  code_emit(ret);
+  code_emit(int3);
+  code_emit(mov_rsi_rsi);    // fast load from tagged memory
+  code_emit(ret);
+  code_emit(int3);
+  return variant;
+}
+#endif
+
+__attribute__((noinline))
+void generate_code(size_t start_count, size_t end_count) {
+  // Generate our test code, one variant for each nop_count in the range.
+  size_t variant_count = end_count - start_count;
+  size_t size = 0;
+  for (size_t nop_count = start_count; nop_count < end_count; ++nop_count) {
+    size += nop_count * CODE_NOP_SIZE + CODE_VARIANT_OVERHEAD + CACHE_LINE_SIZE;
+  }
+  size += 2 * (CODE_VARIANT_OVERHEAD + CACHE_LINE_SIZE);
+
+  code_variants = calloc(variant_count, sizeof(function));
+  assert(code_variants);
+  code_variants_start = start_count;
+
+  code_start(size);
+  for (size_t i = 0; i < variant_count; ++i) {
+    code_variants[i] = generate_variant(start_count + i);
+  }
+  calibration_variants[0] = generate_calibration_variant(false);
+  calibration_variants[1] = generate_calibration_variant(true);
   code_finish();
 }
 
@@ -104,8 +226,7 @@ void* map_and_zero(size_t size, bool tagged) {
   if (tagged) {
     prot |= PROT_MTE;
   }
-  uint64_t* ptr = (uint64_t*)mmap(NULL, size, prot,
-    MAP_ANONYMOUS|MAP_PRIVATE, -1, 0);
+  uint64_t* ptr = (uint64_t*)map_memory(size, prot);
   if (tagged) {
     ptr = mte_tag_and_zero(ptr, size);
   } else {
@@ -128,72 +249,920 @@ uint32_t prng() {
   return (prng_state + prng_counter) >> 32;
 }
 
-void run_tests(int cpu, size_t iterations, size_t start_count, size_t end_count) {
-  uint64_t* slow_ptr = (uint64_t*)(char*)map_and_zero(0x20000, false);
-  uint64_t* timing_ptr = (uint64_t*)(char*)map_and_zero(0x20000, false);
-  uint64_t* right_tag_ptr = map_and_zero(0x20000, true);
+// Each test only touches the first granule of its buffers, so rather than
+// retagging a whole buffer for every test, a small pool of buffers is tagged
+// up-front and each test retags the first granule of the next buffer in turn.
+// This keeps the cache and TLB footprint of the tests small and fixed.
+#define DEFAULT_BUFFER_SIZE ((size_t)0x1000)
+#define TAGGED_BUFFER_COUNT ((size_t)16)
+
+size_t buffer_size = DEFAULT_BUFFER_SIZE;
+
+// Whether to tag or discard samples from batches that were disturbed.
+noise_mode_t noise_mode = NOISE_IGNORE;
+
+// See lib/environment.h.
+bool hardened = false;
+bool huge_pages = false;
+
+// Whether to calibrate the latency threshold before testing (-C).
+bool calibrate = false;
+
+typedef struct {
+  uint64_t* slow_ptr;
+  uint64_t* timing_ptr;
+  uint64_t* tagged_ptrs[TAGGED_BUFFER_COUNT];
+  size_t next_tagged;
+} test_buffers_t;
+
+void test_buffers_init(test_buffers_t* buffers) {
+  buffers->slow_ptr = map_and_zero(buffer_size, false);
+  buffers->timing_ptr = map_and_zero(buffer_size, false);
+  char* tagged = map_and_zero(buffer_size * TAGGED_BUFFER_COUNT, true);
+  for (size_t i = 0; i < TAGGED_BUFFER_COUNT; ++i) {
+    buffers->tagged_ptrs[i] = (uint64_t*)(tagged + i * buffer_size);
+  }
+  buffers->next_tagged = 0;
+}
+
+// Returns the next tagged buffer, with a fresh tag.
+__attribute__((always_inline))
+static inline uint64_t* test_buffers_next_tagged(test_buffers_t* buffers) {
+  uint64_t* ptr = buffers->tagged_ptrs[buffers->next_tagged];
+  buffers->next_tagged = (buffers->next_tagged + 1) % TAGGED_BUFFER_COUNT;
+#if defined(MTE_EMULATION)
+  // The gadgets access the buffer directly, which emulated tags can't check,
+  // so pass them the untagged address.
+  return mte_strip_tag(mte_tag_granule_and_zero(ptr));
+#else
+  return mte_tag_granule_and_zero(ptr);
+#endif
+}
 
-  for (size_t i = 0; i < iterations; ++i) {
-    right_tag_ptr = mte_tag_and_zero(right_tag_ptr, 0x20000);
+// Number of iterations used to train the branch predictor for each test,
+// including the test itself. This is tuned per core type with -T.
+uint64_t branch_predictor_iterations = BRANCH_PREDICTOR_ITERATIONS;
 
-    uint32_t random = prng();
-    size_t nop_count = start_count + (((random << 1) >> 1) % (end_count - start_count));
-    bool pass = random >> 31;
-    generate_code(nop_count);
+// Where -T saves the tuned iterations, and the tests load them from (-t).
+const char* tuning_path = BRANCH_PREDICTOR_TUNING_PATH;
 
-    uint64_t latency = 0;
+// Runs a single test after training the branch predictor, and returns the
+// measured latency. With measure false, the final iteration is also a training
+// iteration, which is used as a baseline when tuning the number of iterations.
+__attribute__((always_inline))
+static inline uint64_t run_test(function code_function, uint64_t* slow_ptr,
+                                uint64_t* timing_ptr, uint64_t* right_tag_ptr,
+                                bool pass, uint64_t iterations, bool measure) {
+  uint64_t latency = 0;
+  uint64_t last_iteration = measure ? iterations : 0;
 
-    // [1] BRANCH_PREDICTOR_ITERATIONS branches
-    for (uint64_t j = 0; j < BRANCH_PREDICTOR_ITERATIONS; ++j) {
-      // Only the last iteration is not a warmup. This needs to compile
-      // branch-free...
-      uint64_t is_warmup = ((j + 1) ^ BRANCH_PREDICTOR_ITERATIONS) != 0;
-      *slow_ptr = is_warmup + *right_tag_ptr;
+  // [1] iterations branches
+  for (uint64_t j = 0; j < iterations; ++j) {
+    // Only the last iteration is not a warmup. This needs to compile
+    // branch-free...
+    uint64_t is_warmup = ((j + 1) ^ last_iteration) != 0;
+    *slow_ptr = is_warmup + *right_tag_ptr;
 
-      // On the last iteration we might be clearing the tag bit, if we're
-      // supposed to be failing the tag check. This also needs to compile
-      // branch-free...
-      uintptr_t ptr_mask = 0xfffffffffffffffful
-                           ^ (!pass * !is_warmup * 0xff00000000000000ul);
-      uint64_t* tag_ptr = (uint64_t*)((uintptr_t)right_tag_ptr & ptr_mask);
+    // On the last iteration we might be clearing the tag bit, if we're
+    // supposed to be failing the tag check. This also needs to compile
+    // branch-free...
+    uintptr_t ptr_mask = 0xfffffffffffffffful
+                         ^ (!pass * !is_warmup * 0xff00000000000000ul);
+    uint64_t* tag_ptr = (uint64_t*)((uintptr_t)right_tag_ptr & ptr_mask);
 
-      // We want `slow_ptr` and `timing_ptr` to be uncached, and
-      // `right_tag_ptr` to be cached.
-      local_memory_barrier();
-      flush_data_cache(slow_ptr);
-      flush_data_cache(timing_ptr);
-      local_memory_barrier();
-      instruction_barrier();
+    // We want `slow_ptr` and `timing_ptr` to be uncached, and
+    // `right_tag_ptr` to be cached.
+    local_memory_barrier();
+    flush_data_cache(slow_ptr);
+    flush_data_cache(timing_ptr);
+    local_memory_barrier();
+    instruction_barrier();
 
-      // [2] BRANCH_PREDICTOR_ITERATIONS branches
-      code_function(slow_ptr, tag_ptr, timing_ptr);
+    // [2] iterations branches
+    code_function(slow_ptr, tag_ptr, timing_ptr);
 
-      latency = read_latency(timing_ptr);
+    latency = read_latency(timing_ptr);
+  }
+  return latency;
+}
+
+// State for adaptive sampling, which stops testing each nop count once the
+// latencies with and without a tag check failure are classified as the same or
+// different with enough confidence.
+typedef struct {
+  classifier_t classifier;
+  // Whether the fast/slow threshold comes from calibration, rather than from
+  // splitting the pooled samples.
+  bool calibrated;
+  // All of the samples so far, used to choose the fast/slow threshold.
+  distribution_t pooled;
+  // Indexed by nop count, then by whether the tag check passed.
+  distribution_t (*latencies)[2];
+  classification_t* classifications;
+} adaptive_t;
+
+// A non-zero threshold is a calibrated threshold, which is used throughout.
+adaptive_t* adaptive_start(double confidence, size_t start_count, size_t end_count,
+                           uint64_t threshold) {
+  adaptive_t* adaptive = malloc(sizeof(adaptive_t));
+  assert(adaptive);
+  classifier_init(&adaptive->classifier, confidence, ADAPTIVE_TOLERANCE,
+                  ADAPTIVE_MIN_SAMPLES);
+  adaptive->calibrated = threshold != 0;
+  adaptive->classifier.threshold = threshold;
+  distribution_reset(&adaptive->pooled);
+  adaptive->latencies = calloc(end_count - start_count, sizeof(distribution_t[2]));
+  adaptive->classifications = calloc(end_count - start_count, sizeof(classification_t));
+  assert(adaptive->latencies && adaptive->classifications);
+  return adaptive;
+}
+
+// Classifies the remaining active nop counts, and removes the ones that have
+// been decided. Returns the new number of active nop counts.
+size_t adaptive_update(adaptive_t* adaptive, size_t start_count, size_t* active,
+                       size_t active_count) {
+  if (!adaptive->calibrated) {
+    adaptive->classifier.threshold = distribution_split(&adaptive->pooled);
+  }
+
+  size_t remaining = 0;
+  for (size_t i = 0; i < active_count; ++i) {
+    size_t index = active[i] - start_count;
+    adaptive->classifications[index] = classify(&adaptive->classifier,
+                                                &adaptive->latencies[index][0],
+                                                &adaptive->latencies[index][1]);
+    if (adaptive->classifications[index] == CLASSIFICATION_UNDECIDED) {
+      active[remaining++] = active[i];
     }
+  }
+  return remaining;
+}
 
-    printf("%i,%i,%zu,%zu\n", cpu, pass, nop_count, latency);
+void adaptive_finish(adaptive_t* adaptive, size_t iterations,
+                     size_t start_count, size_t end_count) {
+  size_t undecided = 0;
+  for (size_t nop_count = start_count; nop_count < end_count; ++nop_count) {
+    size_t index = nop_count - start_count;
+    distribution_t* latencies = adaptive->latencies[index];
+    uint64_t threshold = adaptive->classifier.threshold;
+    fprintf(stderr, "nop_count %zu: %s (fast %lu/%lu tag mismatch, %lu/%lu tag match)\n",
+            nop_count, classification_name(adaptive->classifications[index]),
+            distribution_count_below(&latencies[0], threshold), latencies[0].total,
+            distribution_count_below(&latencies[1], threshold), latencies[1].total);
+    undecided += adaptive->classifications[index] == CLASSIFICATION_UNDECIDED;
   }
+  fprintf(stderr, "adaptive sampling: %zu iterations, %s threshold %lu, %zu undecided\n",
+          iterations, adaptive->calibrated ? "calibrated" : "split",
+          adaptive->classifier.threshold, undecided);
+
+  free(adaptive->latencies);
+  free(adaptive->classifications);
+  free(adaptive);
 }
 
-int main(int argc, char** argv) {
-  if (argc != 6) {
-    fprintf(stderr, "usage: speculation_window cpu_id seed iterations start_count end_count\n");
+// Measures the latency with timing_ptr known to be cached and known to be
+// uncached, using the calibration variants of the gadget, which include all of
+// the fixed costs of a test. Fits the threshold that best separates the two.
+// Tests are only ever classified against that threshold, which was fitted on
+// latencies with the same fixed costs, so there's no overhead to subtract.
+result_calibration_t run_calibration(int cpu, test_buffers_t* buffers) {
+  distribution_t latencies[2];
+  distribution_reset(&latencies[0]);
+  distribution_reset(&latencies[1]);
+  for (size_t i = 0; i < CALIBRATION_ITERATIONS * 2; ++i) {
+    bool cached = prng() >> 31;
+    uint64_t* right_tag_ptr = test_buffers_next_tagged(buffers);
+    uint64_t latency = run_test(calibration_variants[cached], buffers->slow_ptr,
+                                buffers->timing_ptr, right_tag_ptr, true,
+                                branch_predictor_iterations, true);
+    distribution_add(&latencies[cached], latency);
+  }
+
+  result_calibration_t calibration = {0};
+  calibration.cpu = cpu;
+  calibration.threshold = distribution_separate(&latencies[1], &latencies[0]);
+  calibration.hit_latency = distribution_percentile(&latencies[1], 50);
+  calibration.miss_latency = distribution_percentile(&latencies[0], 50);
+  fprintf(stderr, "cpu %i calibration: hit latency %lu, miss latency %lu, threshold %lu"
+          " (%.3f hits, %.3f misses misclassified)\n", cpu, calibration.hit_latency,
+          calibration.miss_latency, calibration.threshold,
+          1.0 - distribution_fraction_below(&latencies[1], calibration.threshold),
+          distribution_fraction_below(&latencies[0], calibration.threshold));
+  return calibration;
+}
+
+// Runs up to iterations tests with nop counts in [start_count, end_count). With
+// a non-zero confidence, stops testing each nop count once its result is known
+// with that confidence.
+void run_tests(int cpu, size_t iterations, size_t start_count, size_t end_count,
+               double confidence, results_t* results, distribution_t* latencies) {
+  test_buffers_t buffers;
+  test_buffers_init(&buffers);
+
+  generate_code(start_count, end_count);
+
+  size_t active_count = end_count - start_count;
+  size_t* active = malloc(sizeof(size_t) * active_count);
+  assert(active);
+  for (size_t i = 0; i < active_count; ++i) {
+    active[i] = start_count + i;
+  }
+
+  uint64_t threshold = 0;
+  if (calibrate) {
+    result_calibration_t calibration = run_calibration(cpu, &buffers);
+    threshold = calibration.threshold;
+    if (results) {
+      results_add_calibration(results, &calibration);
+    }
+  }
+
+  adaptive_t* adaptive = NULL;
+  if (confidence) {
+    adaptive = adaptive_start(confidence, start_count, end_count, threshold);
+  }
+
+  noise_stats_t noise_stats;
+  if (noise_mode != NOISE_IGNORE) {
+    noise_start();
+    noise_stats_reset(&noise_stats);
+  }
+  size_t batch_size = noise_mode != NOISE_IGNORE ? NOISE_BATCH_SIZE : 1;
+
+  // Discarded batches are run again rather than taken out of iterations,
+  // until they have cost as many tests again as iterations.
+  size_t discarded = 0;
+  size_t kept_total = 0;
+  size_t i = 0;
+  while (i < iterations && active_count) {
+    result_t batch[NOISE_BATCH_SIZE];
+    size_t count = 0;
+
+    if (noise_mode != NOISE_IGNORE) {
+      noise_read();
+    }
+
+    for (; count < batch_size && i < iterations; ++count, ++i) {
+      uint64_t* right_tag_ptr = test_buffers_next_tagged(&buffers);
+
+      uint32_t random = prng();
+      size_t nop_count = active[((random << 1) >> 1) % active_count];
+      bool pass = random >> 31;
+      function code_function = code_variants[nop_count - code_variants_start];
+
+      uint64_t latency = run_test(code_function, buffers.slow_ptr,
+                                  buffers.timing_ptr, right_tag_ptr, pass,
+                                  branch_predictor_iterations, true);
+
+      uint8_t flags = environment_demoted() ? RESULT_FLAG_DEMOTED : 0;
+      result_t record = {cpu, pass, flags, nop_count, latency};
+      batch[count] = record;
+    }
+
+    bool disturbed = false;
+    if (noise_mode != NOISE_IGNORE) {
+      noise_t noise = noise_read();
+      disturbed = noise_disturbed(&noise);
+      noise_stats_add(&noise_stats, &noise, disturbed && noise_mode == NOISE_DISCARD);
+    }
+
+    size_t kept = disturbed && noise_mode == NOISE_DISCARD ? 0 : count;
+    if (!kept && discarded < iterations) {
+      discarded += count;
+      i -= count;
+      continue;
+    }
+    kept_total += kept;
+    for (size_t j = 0; j < kept; ++j) {
+      result_t* record = &batch[j];
+      if (disturbed) {
+        record->flags |= RESULT_FLAG_DISTURBED;
+      } else {
+        if (latencies) {
+          distribution_add(&latencies[record->tag_match], record->latency);
+        }
+        if (adaptive) {
+          distribution_add(&adaptive->latencies[record->nop_count - start_count][record->tag_match],
+                           record->latency);
+          distribution_add(&adaptive->pooled, record->latency);
+        }
+      }
+
+      if (results) {
+        results_append(results, record);
+      } else if (noise_mode != NOISE_IGNORE) {
+        printf("%i,%i,%u,%lu,%i\n", record->cpu, record->tag_match,
+               record->nop_count, record->latency, record->flags);
+      } else {
+        printf("%i,%i,%u,%lu\n", record->cpu, record->tag_match,
+               record->nop_count, record->latency);
+      }
+    }
+
+    if (adaptive && i / ADAPTIVE_BATCH_SIZE != (i - count) / ADAPTIVE_BATCH_SIZE) {
+      active_count = adaptive_update(adaptive, start_count, active, active_count);
+    }
+  }
+
+  if (noise_mode != NOISE_IGNORE) {
+    noise_stop(&noise_stats);
+    print_noise_stats(&noise_stats);
+    if (discarded >= iterations) {
+      fprintf(stderr, "noise: stopped retrying discarded batches after %zu tests, "
+                      "kept %zu of %zu iterations\n", discarded, kept_total, iterations);
+    }
+  }
+  print_environment(cpu);
+
+  if (adaptive) {
+    adaptive_update(adaptive, start_count, active, active_count);
+    adaptive_finish(adaptive, i, start_count, end_count);
+  }
+  free(active);
+}
+
+// Branch predictor tuning runs the tests in batches of this size between
+// reading the performance counters.
+#define TUNING_BATCH_SIZE ((size_t)16)
+
+// Returns the average number of branch misses caused by the test itself, ie.
+// the difference between batches of tests with the final iteration measured,
+// and batches where the final iteration is one more training iteration. Once
+// the branch predictor is trained, the test branch is always mispredicted.
+double test_branch_misses(function code_function, test_buffers_t* buffers,
+                          uint64_t iterations, size_t batches) {
+  int64_t misses = 0;
+  uint64_t instructions = 0;
+  for (size_t i = 0; i < batches * 2; ++i) {
+    bool measure = i & 1;
+    read_perf_counters();
+    for (size_t j = 0; j < TUNING_BATCH_SIZE; ++j) {
+      uint64_t* right_tag_ptr = test_buffers_next_tagged(buffers);
+      run_test(code_function, buffers->slow_ptr, buffers->timing_ptr,
+               right_tag_ptr, prng() >> 31, iterations, measure);
+    }
+    perf_t perf = read_perf_counters();
+    misses += measure ? (int64_t)perf.branch_misses : -(int64_t)perf.branch_misses;
+    instructions += perf.instructions;
+  }
+
+  if (!instructions) {
+    fprintf(stderr, "tuning needs the branch miss and instruction performance counters\n");
+    exit(-1);
+  }
+  return (double)misses / (double)(batches * TUNING_BATCH_SIZE);
+}
+
+// Finds the smallest number of branch predictor iterations after which the
+// test branch is reliably mispredicted, running around tests tests for each
+// candidate. Returns 0 if there isn't one up to BRANCH_PREDICTOR_TUNING_MAX.
+uint64_t tune_branch_predictor(int cpu, size_t tests, size_t nop_count) {
+  test_buffers_t buffers;
+  test_buffers_init(&buffers);
+
+  generate_code(nop_count, nop_count + 1);
+  function code_function = code_variants[0];
+  size_t batches = tests / TUNING_BATCH_SIZE + 1;
+
+  // Double the number of iterations until the predictor is trained, and then
+  // binary search for the smallest number that still trains it. This assumes
+  // that more iterations never leave the predictor less well trained.
+  uint64_t trained = 2;
+  for (;;) {
+    double misses = test_branch_misses(code_function, &buffers, trained,
+                                       batches);
+    fprintf(stderr, "cpu %i: %lu iterations, %.3f test branch misses\n",
+            cpu, trained, misses);
+    if (misses >= BRANCH_PREDICTOR_TUNING_TARGET) {
+      break;
+    }
+    if (trained >= BRANCH_PREDICTOR_TUNING_MAX) {
+      return 0;
+    }
+    trained *= 2;
+  }
+
+  uint64_t untrained = trained / 2;
+  while (trained - untrained > 1) {
+    uint64_t iterations = untrained + (trained - untrained) / 2;
+    double misses = test_branch_misses(code_function, &buffers, iterations,
+                                       batches);
+    fprintf(stderr, "cpu %i: %lu iterations, %.3f test branch misses\n",
+            cpu, iterations, misses);
+    if (misses >= BRANCH_PREDICTOR_TUNING_TARGET) {
+      trained = iterations;
+    } else {
+      untrained = iterations;
+    }
+  }
+  return trained;
+}
+
+typedef struct {
+  size_t tests;
+  size_t nop_count;
+  const int* timers;
+  uint64_t* iterations;
+} tuning_t;
+
+static void run_tuning_worker(size_t index, int cpu, void* arg) {
+  tuning_t* tuning = arg;
+  select_timer(tuning->timers[index]);
+  mte_enable(false, DEFAULT_TAG_MASK);
+  tuning->iterations[index] = tune_branch_predictor(cpu, tuning->tests,
+                                                    tuning->nop_count);
+}
+
+// Tunes the branch predictor iterations on one core of each type in cpus, in
+// parallel, and saves the results for the main runs to use. Returns false if a
+// core type couldn't be tuned or saved.
+bool run_tuning(const int* cpus, size_t cpu_count, size_t tests, size_t nop_count) {
+  int tuning_cpus[CPU_SETSIZE];
+  uint64_t types[CPU_SETSIZE];
+  int timers[CPU_SETSIZE];
+  size_t count = 0;
+  for (size_t i = 0; i < cpu_count; ++i) {
+    uint64_t type = cpu_type_of(cpus[i]);
+    size_t j = 0;
+    while (j < count && types[j] != type) {
+      ++j;
+    }
+    if (j == count) {
+      types[count] = type;
+      tuning_cpus[count] = cpus[i];
+      count += 1;
+    }
+  }
+
+  for (size_t i = 0; i < count; ++i) {
+    timer_reserve_cpu(tuning_cpus[i]);
+  }
+  for (size_t i = 0; i < count; ++i) {
+    timers[i] = start_timer(tuning_cpus[i]);
+  }
+
+  tuning_t tuning = {tests, nop_count, timers, map_shared(sizeof(uint64_t) * count)};
+  bool tuned = !run_workers(tuning_cpus, count, run_tuning_worker, &tuning);
+
+  for (size_t i = 0; i < count; ++i) {
+    if (tuning.iterations[i]) {
+      fprintf(stderr, "core type %#lx: %lu branch predictor iterations\n",
+              types[i], tuning.iterations[i]);
+      tuned &= tuning_save(tuning_path, types[i], tuning.iterations[i]);
+    } else {
+      fprintf(stderr, "core type %#lx: branch predictor not trained after %i iterations\n",
+              types[i], BRANCH_PREDICTOR_TUNING_MAX);
+      tuned = false;
+    }
+  }
+  return tuned;
+}
+
+// Uses the tuned number of branch predictor iterations for the core type, if
+// there is one.
+void load_branch_predictor_iterations(int cpu) {
+  uint64_t iterations;
+  if (tuning_load(tuning_path, cpu_type_of(cpu), &iterations)) {
+    branch_predictor_iterations = iterations;
+  }
+  fprintf(stderr, "cpu %i: %lu branch predictor iterations\n", cpu,
+          branch_predictor_iterations);
+}
+
+// Per-process setup, once pinned to the core under test.
+void prepare_test_process(int cpu) {
+  load_branch_predictor_iterations(cpu);
+  if (hardened) {
+    harden_environment(huge_pages);
+  }
+}
+
+// Workers whose latency distribution is further than this from the pooled
+// distribution of all cores of the same type are flagged as outliers.
+#define OUTLIER_DISTANCE (0.1)
+
+typedef struct {
+  int cpu;
+  uint64_t type;
+  size_t iterations;
+  uint64_t seed;
+  int timer;
+  // Indexed by whether the tag check passed.
+  distribution_t latencies[2];
+} worker_t;
+
+typedef struct {
+  worker_t* workers;
+  size_t worker_count;
+  size_t start_count;
+  size_t end_count;
+  double confidence;
+  const char* results_path;
+} parallel_tests_t;
+
+static char* worker_results_path(const char* results_path, int cpu) {
+  char* path;
+  assert(0 < asprintf(&path, "%s.cpu%i", results_path, cpu));
+  return path;
+}
+
+static void run_worker(size_t index, int cpu, void* arg) {
+  parallel_tests_t* tests = arg;
+  worker_t* worker = &tests->workers[index];
+
+  prng_state = worker->seed;
+  prng_counter = 0;
+  select_timer(worker->timer);
+  prepare_test_process(cpu);
+
+  results_t* results = NULL;
+  if (tests->results_path) {
+    char* path = worker_results_path(tests->results_path, cpu);
+    results = results_open(path, timer_frequency(), worker->seed);
+    free(path);
+  }
+
+  mte_enable(false, DEFAULT_TAG_MASK);
+
+  run_tests(cpu, worker->iterations, tests->start_count, tests->end_count,
+            tests->confidence, results, worker->latencies);
+
+  if (results) {
+    results_close(results);
+  }
+}
+
+static void print_parallel_summary(const parallel_tests_t* tests) {
+  for (size_t i = 0; i < tests->worker_count; ++i) {
+    const worker_t* first = &tests->workers[i];
+    bool seen = false;
+    for (size_t j = 0; j < i; ++j) {
+      seen |= tests->workers[j].type == first->type;
+    }
+    if (seen) {
+      continue;
+    }
+
+    distribution_t pooled[2];
+    distribution_reset(&pooled[0]);
+    distribution_reset(&pooled[1]);
+    size_t core_count = 0;
+    for (size_t j = i; j < tests->worker_count; ++j) {
+      if (tests->workers[j].type == first->type) {
+        distribution_merge(&pooled[0], &tests->workers[j].latencies[0]);
+        distribution_merge(&pooled[1], &tests->workers[j].latencies[1]);
+        ++core_count;
+      }
+    }
+
+    fprintf(stderr, "core type %#lx: %zu cores, median latency %lu (tag mismatch) %lu (tag match)\n",
+            first->type, core_count, distribution_percentile(&pooled[0], 50),
+            distribution_percentile(&pooled[1], 50));
+    for (size_t j = i; j < tests->worker_count; ++j) {
+      const worker_t* worker = &tests->workers[j];
+      if (worker->type != first->type) {
+        continue;
+      }
+      double distance = distribution_distance(&worker->latencies[0], &pooled[0]);
+      double pass_distance = distribution_distance(&worker->latencies[1], &pooled[1]);
+      if (pass_distance > distance) {
+        distance = pass_distance;
+      }
+      fprintf(stderr, "  cpu %i: %zu iterations, median latency %lu %lu, distance %.3f%s\n",
+              worker->cpu, worker->iterations,
+              distribution_percentile(&worker->latencies[0], 50),
+              distribution_percentile(&worker->latencies[1], 50), distance,
+              distance > OUTLIER_DISTANCE ? " OUTLIER" : "");
+    }
+  }
+}
+
+// Runs the tests on each of the cores in parallel, with one worker process per
+// core. Cores of the same type split the iterations between them, so that each
+// core type gets the full number of iterations. Returns false if any worker
+// failed, in which case the results are incomplete.
+bool run_parallel_tests(const int* cpus, size_t cpu_count, uint64_t seed,
+                        size_t iterations, size_t start_count, size_t end_count,
+                        double confidence, const char* results_path) {
+  parallel_tests_t tests = {
+    map_shared(sizeof(worker_t) * cpu_count), cpu_count, start_count, end_count,
+    confidence, results_path
+  };
+
+  for (size_t i = 0; i < cpu_count; ++i) {
+    timer_reserve_cpu(cpus[i]);
+    tests.workers[i].cpu = cpus[i];
+    tests.workers[i].type = cpu_type_of(cpus[i]);
+  }
+
+  for (size_t i = 0; i < cpu_count; ++i) {
+    worker_t* worker = &tests.workers[i];
+    size_t group_size = 0;
+    size_t rank = 0;
+    for (size_t j = 0; j < cpu_count; ++j) {
+      if (tests.workers[j].type == worker->type) {
+        group_size += 1;
+        rank += j < i;
+      }
+    }
+    worker->iterations = iterations / group_size + (rank < iterations % group_size);
+    // Each worker needs its own independent sequence of test parameters.
+    worker->seed = seed + i * 0x9e3779b97f4a7c15ull;
+    worker->timer = start_timer(worker->cpu);
+    distribution_reset(&worker->latencies[0]);
+    distribution_reset(&worker->latencies[1]);
+  }
+
+  // Without a results file, every worker writes CSV lines to stdout, so make
+  // sure that they are written out whole.
+  setvbuf(stdout, NULL, _IOLBF, 0);
+  bool complete = !run_workers(cpus, cpu_count, run_worker, &tests);
+
+  if (results_path) {
+    results_t* results = results_open(results_path, timer_frequency(), seed);
+    for (size_t i = 0; i < cpu_count; ++i) {
+      char* path = worker_results_path(results_path, cpus[i]);
+      if (!results_merge(results, path)) {
+        fprintf(stderr, "missing results from cpu %i\n", cpus[i]);
+        complete = false;
+      }
+      unlink(path);
+      free(path);
+    }
+    results_close(results);
+  }
+
+  print_parallel_summary(&tests);
+  if (!complete) {
+    fprintf(stderr, "not every worker finished, the results are incomplete\n");
+  }
+  return complete;
+}
+
+// One shard of a sweep: the tests for a set of cores and a range of nop counts,
+// with its own seed and iteration budget.
+typedef struct {
+  int cpus[CPU_SETSIZE];
+  size_t cpu_count;
+  size_t start_count;
+  size_t end_count;
+  size_t iterations;
+  uint64_t seed;
+} shard_t;
+
+// Parses a sweep file, with one shard per line:
+//   cpu_list start_count end_count iterations [seed]
+// Blank lines and lines starting with # are ignored. Shards without a seed get
+// one derived from seed. Returns the number of shards.
+size_t parse_sweep(const char* path, uint64_t seed, shard_t** shards) {
+  FILE* file = fopen(path, "r");
+  if (!file) {
+    fprintf(stderr, "can't open sweep file %s\n", path);
     exit(-1);
   }
 
-  int cpu = atoi(argv[1]);
-  size_t seed = atoi(argv[2]);
-  size_t iterations = atoi(argv[3]);
-  size_t start_count = atoi(argv[4]);
-  size_t end_count = atoi(argv[5]);
+  size_t count = 0;
+  *shards = NULL;
+  char line[256];
+  for (size_t line_number = 1; fgets(line, sizeof(line), file); ++line_number) {
+    char cpu_list[128];
+    shard_t shard;
+    int fields = sscanf(line, "%127s %zu %zu %zu %" SCNu64, cpu_list,
+                        &shard.start_count, &shard.end_count, &shard.iterations,
+                        &shard.seed);
+    if (fields <= 0 || cpu_list[0] == '#') {
+      continue;
+    }
+    shard.cpu_count = cpu_parse_list(cpu_list, shard.cpus, CPU_SETSIZE);
+    if (fields < 4 || !shard.cpu_count || shard.cpu_count > MAX_TIMERS
+        || shard.end_count <= shard.start_count || !shard.iterations) {
+      fprintf(stderr, "%s:%zu: invalid shard\n", path, line_number);
+      exit(-1);
+    }
+    if (fields == 4) {
+      shard.seed = seed + count * 0x9e3779b97f4a7c15ull;
+    }
+
+    *shards = realloc(*shards, sizeof(shard_t) * (count + 1));
+    assert(*shards);
+    (*shards)[count++] = shard;
+  }
+  fclose(file);
+  return count;
+}
+
+// Runs every shard in a sweep file, and writes all of the results to a single
+// results file. Each shard runs in its own process (forking a worker per core
+// as usual), so that timers and test buffers don't accumulate across shards,
+// and with confidence set each nop count stops once it has been classified.
+// Returns false if any shard failed, in which case the results file only holds
+// what the other shards (and any of its workers that finished) produced.
+bool run_sweep(const char* sweep_path, uint64_t seed, double confidence,
+               const char* results_path) {
+  shard_t* shards;
+  size_t shard_count = parse_sweep(sweep_path, seed, &shards);
+
+  // The timers are started by the shards, so the results file takes its timer
+  // frequency from the first shard's results.
+  results_t* results = NULL;
+  size_t failed = 0;
+  for (size_t i = 0; i < shard_count; ++i) {
+    shard_t* shard = &shards[i];
+    char* shard_path;
+    assert(0 < asprintf(&shard_path, "%s.shard%zu", results_path, i));
+    fprintf(stderr, "shard %zu/%zu: %zu cpus, nop counts %zu-%zu, %zu iterations\n",
+            i + 1, shard_count, shard->cpu_count, shard->start_count,
+            shard->end_count, shard->iterations);
+
+    fflush(NULL);
+    pid_t pid = fork();
+    assert(pid >= 0);
+    if (pid == 0) {
+      bool complete = run_parallel_tests(shard->cpus, shard->cpu_count, shard->seed,
+                                         shard->iterations, shard->start_count,
+                                         shard->end_count, confidence, shard_path);
+      fflush(NULL);
+      _exit(complete ? 0 : 1);
+    }
+
+    int status;
+    assert(pid == waitpid(pid, &status, 0));
+    bool complete = WIFEXITED(status) && !WEXITSTATUS(status);
+    if (!complete) {
+      fprintf(stderr, "shard %zu failed (status %i)\n", i + 1, status);
+    }
+    if (!results) {
+      int fd = open(shard_path, O_RDONLY);
+      results_header_t header;
+      if (fd >= 0 && results_read_header(fd, &header)) {
+        results = results_open(results_path, header.timer_frequency, seed);
+      }
+      if (fd >= 0) {
+        close(fd);
+      }
+    }
+    if (!results || !results_merge(results, shard_path)) {
+      fprintf(stderr, "missing results from shard %zu\n", i + 1);
+      complete = false;
+    }
+    failed += !complete;
+    unlink(shard_path);
+    free(shard_path);
+  }
+  if (!results) {
+    results = results_open(results_path, 0, seed);
+  }
+  results_close(results);
+  free(shards);
+
+  if (failed) {
+    fprintf(stderr, "%zu/%zu shards failed, the results are incomplete\n",
+            failed, shard_count);
+  }
+  return !failed;
+}
+
+static void usage() {
+  fprintf(stderr, "usage: speculation_window [-o results_file] [-a confidence] [-b buffer_size] [-n tag|discard] [-H [-L]] [-C] [-T] [-t tuning_file] cpu_list seed iterations start_count end_count\n");
+  fprintf(stderr, "       speculation_window -o results_file -S sweep_file [-a confidence] [-b buffer_size] [-n tag|discard] [-H [-L]] [-C] [-t tuning_file] seed\n");
+  fprintf(stderr, "  cpu_list is a single core, or a list like 0,4-7 to test several cores in parallel\n");
+  fprintf(stderr, "  -a stops testing each nop count once classified with confidence (eg. 0.99),\n");
+  fprintf(stderr, "     with iterations as the upper limit\n");
+  fprintf(stderr, "  -b sets the size of each test buffer in bytes, which must be a multiple of the\n");
+  fprintf(stderr, "     page size (default %#zx)\n", DEFAULT_BUFFER_SIZE);
+  fprintf(stderr, "  -n checks for context switches, migrations and page faults around each batch\n");
+  fprintf(stderr, "     of tests, and tags or discards (and reruns) the samples from disturbed\n");
+  fprintf(stderr, "     batches; interrupts are only counted for the whole run\n");
+  fprintf(stderr, "  -H runs the tests with SCHED_FIFO priority and locked, prefaulted memory,\n");
+  fprintf(stderr, "     and -L also backs the test buffers with huge pages\n");
+  fprintf(stderr, "  -T tunes the branch predictor iterations for each core type in cpu_list,\n");
+  fprintf(stderr, "     running around iterations tests of start_count nops per step\n");
+  fprintf(stderr, "  -t sets the file that -T saves the tuned iterations to and the tests load\n");
+  fprintf(stderr, "     them from (default %s)\n", BRANCH_PREDICTOR_TUNING_PATH);
+  fprintf(stderr, "  -C calibrates the cache hit threshold of the tests on each core first, and\n");
+  fprintf(stderr, "     stores it in the results file and uses it for -a\n");
+  fprintf(stderr, "  -S runs every shard in sweep_file, one per line as\n");
+  fprintf(stderr, "     cpu_list start_count end_count iterations [seed]\n");
+  exit(-1);
+}
+
+int main(int argc, char** argv) {
+  const char* results_path = NULL;
+  const char* sweep_path = NULL;
+  double confidence = 0.0;
+  bool tune = false;
+
+  int opt;
+  while ((opt = getopt(argc, argv, "o:a:b:n:HLCTt:S:")) != -1) {
+    switch (opt) {
+      case 'o':
+        results_path = optarg;
+        break;
+      case 'a':
+        confidence = atof(optarg);
+        if (confidence <= 0.0 || confidence >= 1.0) {
+          usage();
+        }
+        break;
+      case 'b':
+        buffer_size = strtoull(optarg, NULL, 0);
+        if (!buffer_size || buffer_size % getpagesize()) {
+          usage();
+        }
+        break;
+      case 'n':
+        if (!strcmp(optarg, "tag")) {
+          noise_mode = NOISE_TAG;
+        } else if (!strcmp(optarg, "discard")) {
+          noise_mode = NOISE_DISCARD;
+        } else {
+          usage();
+        }
+        break;
+      case 'H':
+        hardened = true;
+        break;
+      case 'L':
+        huge_pages = true;
+        break;
+      case 'C':
+        calibrate = true;
+        break;
+      case 'T':
+        tune = true;
+        break;
+      case 't':
+        tuning_path = optarg;
+        break;
+      case 'S':
+        sweep_path = optarg;
+        break;
+      default:
+        usage();
+    }
+  }
+
+  if (huge_pages && !hardened) {
+    usage();
+  }
+
+  if (sweep_path) {
+    if (argc - optind != 1 || !results_path || tune) {
+      usage();
+    }
+    set_max_priority();
+    return run_sweep(sweep_path, strtoull(argv[optind], NULL, 0), confidence,
+                     results_path) ? 0 : 1;
+  }
+
+  if (argc - optind != 5) {
+    usage();
+  }
+
+  int cpus[CPU_SETSIZE];
+  size_t cpu_count = cpu_parse_list(argv[optind], cpus, CPU_SETSIZE);
+  if (!cpu_count) {
+    usage();
+  }
+  if (cpu_count > MAX_TIMERS) {
+    fprintf(stderr, "at most %zu cores can be tested at once with this timer\n",
+            MAX_TIMERS);
+    exit(-1);
+  }
+  int cpu = cpus[0];
+  size_t seed = atoi(argv[optind + 1]);
+  size_t iterations = atoi(argv[optind + 2]);
+  size_t start_count = atoi(argv[optind + 3]);
+  size_t end_count = atoi(argv[optind + 4]);
 
   prng_state = seed;
 
   set_max_priority();
-  start_timer();
+
+  if (tune) {
+    return run_tuning(cpus, cpu_count, iterations, start_count) ? 0 : 1;
+  }
+
+  if (cpu_count > 1) {
+    return run_parallel_tests(cpus, cpu_count, seed, iterations, start_count,
+                              end_count, confidence, results_path) ? 0 : 1;
+  }
+
+  start_timer(cpu);
+  print_timer_info();
+
+  results_t* results = NULL;
+  if (results_path) {
+    results = results_open(results_path, timer_frequency(), seed);
+  }
 
   mte_enable(false, DEFAULT_TAG_MASK);
   cpu_pin_to(cpu);
+  prepare_test_process(cpu);
+
+  run_tests(cpu, iterations, start_count, end_count, confidence, results, NULL);
 
-  run_tests(cpu, iterations, start_count, end_count);
+  if (results) {
+    results_close(results);
+  }
 }
\ No newline at end of file
@@ -15,22 +15,32 @@
 # limitations under the License.
 
 from config import CONFIG
+from results import summarise
 
-from collections import defaultdict
-import io
 import os
-import numpy as np
-import pandas as pd
 import random
 import re
 import subprocess
 import sys
+import tempfile
 
 
-def load_data(data_dir):
-  index_re = re.compile('speculation_window_(\\d+).pqt')
+DEVICE_PATH = '/data/local/tmp'
+# Each configuration runs for up to this many iterations, but stops early once
+# every nop count has been classified with this confidence.
+ITERATIONS = 1 << 20
+CONFIDENCE = 0.99
+# Samples from batches disturbed by interrupts, context switches etc. are kept
+# but flagged, and left out of the summary.
+NOISE_MODE = 'tag'
+
+
+# Results are kept as the raw results files, which results_summary aggregates
+# without loading everything into memory. New files are numbered after the
+# highest index already in data_dir.
+def last_index(data_dir):
+  index_re = re.compile('speculation_window_(\\d+)\\.bin')
   max_index = 0
-  dfs = [pd.DataFrame(columns=['cpu', 'tag_match', 'nop_count', 'latency'])]
   for root, dirs, files in os.walk(data_dir):
     for file in files:
       index_match = index_re.search(file)
@@ -38,49 +48,70 @@ def load_data(data_dir):
         index = int(index_match.group(1))
         if index > max_index:
           max_index = index
-        df = pd.read_parquet(os.path.join(root, file))
-        dfs.append(df)
-  return max_index, pd.concat(dfs, ignore_index=True)
-
-
-def run(cpu, start, end):
-  try:
-    seed = random.randrange(0, 0xffffffff);
-    result = subprocess.run(
-      ['adb', 'shell', f'sh -c "/data/local/tmp/speculation_window {cpu} {seed} 4096 {start} {end}"'],
-      capture_output=True, timeout=10)
-    stdout = result.stdout.decode('utf8')
-    buffer = io.StringIO(stdout)
-    # NOTE: If you want to store some data that doesn't fit in a uint8, you need
-    # to change the dtype for that column! eg. if you have a higher precision
-    # clock, this might be necessary for the latency column.
-    df = pd.read_csv(buffer, names=['cpu', 'tag_match', 'nop_count', 'latency'], index_col=False, dtype=defaultdict(np.uint8))
-
-    return df
-  except subprocess.TimeoutExpired:
-    return pd.DataFrame(columns=['cpu', 'tag_match', 'nop_count', 'latency'])
+  return max_index
+
+
+# The whole sweep is described by a sweep file (see speculation_window -S), with
+# one shard per configuration, and runs on the device in a single invocation.
+def sweep_spec(configs):
+  return ''.join(f'{config.cpu} {config.start} {config.end} {ITERATIONS}\n'
+                 for config in configs)
+
+
+# Each core is calibrated first (-C), so that the adaptive sampling classifies
+# against the calibrated cache hit threshold, which is stored in the results.
+def sweep_args(binary, sweep_path, results_path, seed):
+  return [binary, '-o', results_path, '-a', str(CONFIDENCE), '-n', NOISE_MODE,
+          '-C', '-S', sweep_path, str(seed)]
+
+
+# Runs the sweep with speculation_window_host, for testing on the host.
+def run_local(spec, seed):
+  with tempfile.TemporaryDirectory() as tmp_dir:
+    sweep_path = os.path.join(tmp_dir, 'sweep.txt')
+    results_path = os.path.join(tmp_dir, 'speculation_window.bin')
+    with open(sweep_path, 'w') as f:
+      f.write(spec)
+    subprocess.run(sweep_args('./speculation_window_host', sweep_path,
+                              results_path, seed), check=True)
+    with open(results_path, 'rb') as f:
+      return f.read()
+
+
+def run_device(spec, seed):
+  sweep_path = f'{DEVICE_PATH}/speculation_window_sweep.txt'
+  results_path = f'{DEVICE_PATH}/speculation_window.bin'
+  with tempfile.NamedTemporaryFile('w', suffix='.txt') as f:
+    f.write(spec)
+    f.flush()
+    subprocess.run(['adb', 'push', f.name, sweep_path], check=True,
+                   capture_output=True)
+  args = sweep_args(f'{DEVICE_PATH}/speculation_window', sweep_path,
+                    results_path, seed)
+  subprocess.run(['adb', 'shell', ' '.join(args)], check=True)
+  # exec-out gives us the raw bytes, without any line-ending translation.
+  result = subprocess.run(['adb', 'exec-out', f'cat {results_path}'],
+                          capture_output=True, check=True)
+  return result.stdout
 
 
 if __name__ == '__main__':
+  if len(sys.argv) < 2 or sys.argv[2:] not in ([], ['--local']):
+    print(f'usage: {sys.argv[0]} data_dir [--local]')
+    sys.exit(1)
   random.seed()
   data_dir = sys.argv[1]
+  local = sys.argv[2:] == ['--local']
 
-  index, df = load_data(data_dir)
-  counts = {}
+  index = last_index(data_dir)
+  seed = random.randrange(0, 0xffffffff)
+  spec = sweep_spec(CONFIG)
+  data = run_local(spec, seed) if local else run_device(spec, seed)
+  with open(f'{data_dir}/speculation_window_{index + 1}.bin', 'wb') as f:
+    f.write(data)
 
+  summary = summarise([data_dir])
   for config in CONFIG:
-    counts[config.cpu] = len(df.query(f'cpu == {config.cpu} & nop_count == {config.start}'))
-
-  while True:
-    print(counts)
-
-    config = None
-    for config_ in CONFIG:
-      if config is None or counts[config_.cpu] < counts[config.cpu]:
-        config = config_
-
-    df = run(config.cpu, config.start, config.end)
-    counts[config.cpu] += len(df.query(f'cpu == {config.cpu} & nop_count == {config.start}'))
-
-    df.to_parquet(f'{data_dir}/speculation_window_{index}.pqt')
-    index += 1
+    row = summary.get((config.cpu, config.start))
+    count = row['fail_count'] + row['pass_count'] if row else 0
+    print(f'cpu {config.cpu}: {count} samples at nop count {config.start}')